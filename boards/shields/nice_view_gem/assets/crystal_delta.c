@@ -0,0 +1,282 @@
+// Generated by scripts/delta_anim.py from crystal.c.
+// Do not edit; re-run the script after changing the frames.
+
+#include <lvgl.h>
+#include "delta_anim.h"
+
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t crystal_keyframe[] = {
+    0xff, 0xad, 0x01, 0x07, 0x80, 0x86, 0x01, 0x1b, 0xe0, 0x86, 0x01, 0x61, 0x78, 0x85, 0x02,
+    0x01, 0x81, 0xfe, 0x85, 0x03, 0x06, 0x01, 0xfd, 0x80, 0x84, 0x03, 0x18, 0x01, 0xfa, 0xe0,
+    0x84, 0x03, 0x60, 0x01, 0xf0, 0x18, 0x83, 0x04, 0x01, 0x80, 0x01, 0xea, 0xae, 0x81, 0x10,
+    0x08, 0x00, 0x06, 0x00, 0x01, 0xc0, 0x01, 0x80, 0x00, 0x08, 0x00, 0x18, 0x00, 0x01, 0xaa,
+    0xaa, 0xe0, 0x82, 0x02, 0x60, 0x00, 0x01, 0x81, 0x00, 0x18, 0x81, 0x06, 0x01, 0x80, 0x00,
+    0xff, 0xfe, 0xaa, 0xae, 0x81, 0x0a, 0x06, 0x00, 0xff, 0x00, 0x03, 0xfc, 0x01, 0x80, 0x00,
+    0x18, 0x7f, 0x82, 0x05, 0x03, 0xfa, 0xe0, 0x00, 0x7f, 0x80, 0x83, 0x03, 0x07, 0xf8, 0x00,
+    0x60, 0x85, 0x02, 0x18, 0x00, 0x18, 0x85, 0x02, 0x60, 0x00, 0x06, 0x84, 0x04, 0x01, 0x80,
+    0x00, 0x01, 0x80, 0x83, 0x00, 0x06, 0x82, 0x00, 0x60, 0x83, 0x00, 0x18, 0x82, 0x00, 0x18,
+    0x83, 0x00, 0x60, 0x82, 0x00, 0x06, 0x82, 0x01, 0x01, 0x80, 0x82, 0x01, 0x01, 0x80, 0x81,
+    0x00, 0x06, 0x84, 0x00, 0x60, 0x81, 0x00, 0x18, 0x84, 0x00, 0x18, 0x81, 0x00, 0x60, 0x84,
+    0x03, 0x06, 0x00, 0x01, 0x80, 0x84, 0x02, 0x01, 0x80, 0x06, 0x86, 0x01, 0x60, 0x18, 0x86,
+    0x01, 0x18, 0x60, 0x86, 0x01, 0x07, 0x80, 0xc3, 0x00, 0x40, 0xe9,
+};
+
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t crystal_delta_data[] = {
+    0x31, 0x0f, 0x32, 0x31, 0x40, 0x32, 0xd8, 0x90, 0x23, 0x03, 0x63, 0x74, 0x23, 0x0d, 0x80,
+    0xa9, 0x24, 0x36, 0x01, 0xfd, 0x40, 0x24, 0xd8, 0x00, 0xaf, 0x10, 0x15, 0x01, 0x60, 0x01,
+    0xf3, 0xe0, 0x18, 0x07, 0x80, 0x00, 0xbd, 0x50, 0x00, 0x00, 0x08, 0x18, 0x1e, 0x00, 0x01,
+    0xcf, 0xfe, 0x00, 0x00, 0x08, 0x16, 0x78, 0x00, 0x7e, 0x55, 0x57, 0x80, 0x09, 0x01, 0xe0,
+    0x0f, 0x81, 0x1f, 0xf8, 0x00, 0x00, 0x08, 0x09, 0x07, 0x81, 0xf0, 0xff, 0xfe, 0x57, 0xf8,
+    0x00, 0x08, 0x09, 0x1e, 0x3e, 0xff, 0x00, 0x03, 0xfb, 0xc0, 0x00, 0x18, 0x09, 0x7f, 0xbf,
+    0x00, 0x00, 0x00, 0x03, 0xc4, 0x80, 0x10, 0x09, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x08, 0x10, 0x08, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x08, 0x64, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x06,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x16,
+    0x64, 0x00, 0x00, 0x00, 0x03, 0x80, 0x15, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x15, 0x06, 0x40,
+    0x00, 0x00, 0x30, 0x15, 0x01, 0x90, 0x00, 0x00, 0xd0, 0x24, 0xe4, 0x00, 0x03, 0x50, 0x24,
+    0x39, 0x00, 0x0d, 0x40, 0x23, 0x0e, 0x40, 0x35, 0x23, 0x03, 0x90, 0xd4, 0x32, 0xe7, 0x50,
+    0x32, 0x3b, 0x40, 0x31, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x40, 0x11, 0x80,
+    0x31, 0x06, 0x32, 0x14, 0x80, 0x32, 0x54, 0x20, 0x23, 0x01, 0x42, 0x28, 0x23, 0x01, 0x00,
+    0xa0, 0x00, 0x32, 0x02, 0xaa, 0x51, 0x80, 0x33, 0x02, 0xa9, 0x50, 0x33, 0x1e, 0x82, 0xa8,
+    0x24, 0x01, 0xe0, 0x75, 0x54, 0x25, 0x1e, 0x7f, 0xf8, 0x2a, 0x80, 0x09, 0x01, 0x01, 0xef,
+    0x80, 0x1f, 0x87, 0xe8, 0x00, 0x08, 0x09, 0x05, 0x0f, 0xf0, 0x00, 0x00, 0xfa, 0xaa, 0x00,
+    0x08, 0x09, 0x04, 0xce, 0x00, 0x00, 0x00, 0x07, 0x3e, 0x00, 0x18, 0x09, 0x18, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x31, 0x80, 0x10, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x10, 0x00, 0x81, 0x20, 0x18, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x60, 0x09, 0x04,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x42, 0x01, 0xc8, 0x09, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x03,
+    0x48, 0x07, 0x08, 0x18, 0x17, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x10, 0x10, 0x17, 0x02, 0xc0,
+    0x00, 0x00, 0x3c, 0x00, 0x0c, 0x15, 0x01, 0x78, 0x00, 0x01, 0xf0, 0x24, 0xa6, 0x00, 0x06,
+    0xc0, 0x23, 0x17, 0xc0, 0x3b, 0x23, 0x0a, 0x70, 0xcc, 0x23, 0x01, 0x6f, 0x30, 0x32, 0xac,
+    0xc8, 0x23, 0x01, 0x43, 0x28, 0x32, 0x40, 0xa0, 0x32, 0x12, 0x80, 0x31, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x80, 0x01, 0x01, 0x31, 0x0f, 0x32, 0x34, 0xc0, 0x32, 0x5a,
+    0xe0, 0x23, 0x01, 0xe0, 0x58, 0x23, 0x07, 0x80, 0x0e, 0x23, 0x0a, 0x00, 0x07, 0x24, 0x3c,
+    0x00, 0x02, 0xc0, 0x24, 0xf0, 0x00, 0x00, 0x70, 0x15, 0x01, 0xc0, 0x0e, 0x00, 0x28, 0x15,
+    0x07, 0x00, 0x72, 0x40, 0x06, 0x16, 0x1e, 0x03, 0x9f, 0xc8, 0x03, 0x80, 0x16, 0x38, 0x1d,
+    0xe0, 0x79, 0x01, 0x40, 0x16, 0xa0, 0xfe, 0x00, 0x07, 0xa2, 0x90, 0x07, 0x03, 0x86, 0xe0,
+    0x00, 0x00, 0x71, 0x5c, 0x07, 0x07, 0x36, 0x00, 0x00, 0x00, 0x06, 0x2a, 0x07, 0x05, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0xc4, 0x07, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x09, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x20, 0x09, 0x06, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x26, 0x40, 0x60, 0x09, 0x05, 0x58, 0x00, 0x00, 0x00, 0x01, 0xba, 0x61, 0xc8,
+    0x09, 0x03, 0xdb, 0x00, 0x00, 0x00, 0x0d, 0xac, 0x1f, 0x08, 0x18, 0x81, 0xe0, 0x00, 0x00,
+    0x7c, 0x50, 0x10, 0x10, 0x18, 0x3d, 0xdc, 0x00, 0x03, 0xb1, 0x40, 0x2c, 0x08, 0x18, 0x1c,
+    0x13, 0x80, 0x1d, 0xc7, 0x80, 0x20, 0x10, 0x17, 0x07, 0x51, 0xf0, 0xe6, 0x0e, 0x00, 0x10,
+    0x15, 0x01, 0x44, 0x2f, 0x38, 0x38, 0x24, 0xea, 0x80, 0xc0, 0xf0, 0x24, 0x31, 0x47, 0x03,
+    0xc0, 0x23, 0x0c, 0x9c, 0x05, 0x23, 0x06, 0x14, 0x1e, 0x23, 0x01, 0xfc, 0x78, 0x32, 0x77,
+    0xa0, 0x32, 0x35, 0xc0, 0x31, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x31,
+    0x09, 0x32, 0x29, 0x40, 0x32, 0x22, 0x80, 0x23, 0x01, 0x21, 0x48, 0x23, 0x05, 0x02, 0xaa,
+    0x23, 0x04, 0x89, 0x54, 0x24, 0x20, 0x1e, 0xaa, 0x40, 0x24, 0xa2, 0x62, 0xd5, 0x50, 0x24,
+    0x83, 0x8f, 0x4a, 0xa0, 0x15, 0x04, 0x8c, 0x70, 0xe9, 0x52, 0x16, 0x14, 0x73, 0x80, 0x1d,
+    0xaa, 0x90, 0x16, 0x13, 0x9c, 0x00, 0x03, 0xb5, 0x10, 0x16, 0x86, 0xe0, 0x00, 0x00, 0x72,
+    0x88, 0x07, 0x02, 0xbf, 0x00, 0x00, 0x00, 0x0f, 0x54, 0x07, 0x02, 0xf8, 0x00, 0x00, 0x00,
+    0x01, 0xe8, 0x07, 0x06, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x34, 0x07, 0x16, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x08, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x08, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0xc8,
+    0x40, 0x17, 0x16, 0x00, 0x00, 0x00, 0x06, 0xc0, 0x60, 0x08, 0x02, 0x98, 0xe0, 0x00, 0x00,
+    0x76, 0x04, 0x18, 0x16, 0x95, 0x1e, 0x00, 0x07, 0xf0, 0x10, 0x18, 0x1f, 0xed, 0xe0, 0x7b,
+    0x80, 0x00, 0x20, 0x08, 0x18, 0x15, 0x41, 0x3f, 0x9c, 0x02, 0x80, 0x20, 0x10, 0x18, 0x05,
+    0xc7, 0xf0, 0xe0, 0x02, 0x00, 0x50, 0x10, 0x26, 0x05, 0x47, 0x00, 0x10, 0x00, 0x20, 0x24,
+    0xbf, 0xf0, 0x00, 0x50, 0x24, 0x25, 0x40, 0x00, 0x40, 0x23, 0x03, 0xc2, 0x02, 0x23, 0x04,
+    0x02, 0x0a, 0x23, 0x01, 0x02, 0x08, 0x32, 0x01, 0x40, 0x32, 0x28, 0x40, 0x31, 0x09, 0x61,
+    0x80, 0x61, 0x40, 0x61, 0x60, 0x61, 0x20, 0x34, 0x06, 0x00, 0x00, 0x30, 0x34, 0x14, 0x80,
+    0x00, 0x30, 0x34, 0x54, 0x20, 0x00, 0x10, 0x34, 0x48, 0x00, 0x00, 0x10, 0x34, 0x5c, 0x00,
+    0x00, 0x10, 0x25, 0x0a, 0x6b, 0x81, 0x00, 0x10, 0x25, 0x0d, 0x9f, 0xe0, 0x00, 0x10, 0x25,
+    0x0c, 0x60, 0x78, 0x00, 0x10, 0x25, 0x5b, 0x80, 0x1e, 0x00, 0x10, 0x24, 0x6c, 0x00, 0x03,
+    0x80, 0x16, 0x01, 0xf0, 0x00, 0x00, 0xe0, 0x10, 0x16, 0x0d, 0x80, 0x00, 0x00, 0x18, 0x10,
+    0x16, 0x9e, 0x00, 0x00, 0x00, 0x06, 0x08, 0x16, 0x58, 0x00, 0x00, 0x00, 0x01, 0x80, 0x07,
+    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0xc0, 0x00, 0x00, 0x00,
+    0x00, 0x31, 0x80, 0x07, 0x07, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x30, 0x06, 0x01, 0x47, 0xf0,
+    0x00, 0x00, 0xff, 0x16, 0x5f, 0xef, 0x82, 0x1f, 0x78, 0x10, 0x16, 0x9d, 0xdc, 0x7f, 0xe7,
+    0x80, 0x10, 0x14, 0x0f, 0xf1, 0xe3, 0x78, 0x14, 0x03, 0x62, 0x35, 0x80, 0x18, 0x01, 0xc0,
+    0x02, 0x00, 0x00, 0x00, 0x40, 0x10, 0x27, 0x08, 0x8a, 0x00, 0x00, 0x00, 0xa0, 0x20, 0x31,
+    0x02, 0x23, 0x02, 0x22, 0x01, 0x23, 0x08, 0x00, 0x01, 0x31, 0x88, 0x32, 0x40, 0x20, 0x32,
+    0x51, 0xa0, 0x32, 0x14, 0x80, 0x31, 0x06, 0x51, 0x60, 0x51, 0xcc, 0x51, 0x9a, 0x51, 0xb1,
+    0x52, 0x30, 0x80, 0x52, 0x20, 0x40, 0x52, 0x20, 0x60, 0x52, 0x20, 0x20, 0x52, 0x20, 0x30,
+    0x34, 0x0f, 0x00, 0x40, 0x30, 0x34, 0x30, 0x40, 0x40, 0x10, 0x34, 0xf2, 0x10, 0x40, 0x10,
+    0x25, 0x03, 0x3e, 0xe4, 0x40, 0x10, 0x25, 0x07, 0x60, 0x78, 0x40, 0x10, 0x25, 0x1b, 0x80,
+    0x1e, 0x40, 0x10, 0x25, 0x76, 0x00, 0x07, 0x80, 0x10, 0x16, 0x01, 0xb8, 0x00, 0x01, 0xa0,
+    0x10, 0x15, 0x02, 0x60, 0x00, 0x00, 0x38, 0x15, 0x0e, 0x80, 0x00, 0x00, 0x5c, 0x15, 0x32,
+    0x00, 0x00, 0x00, 0x47, 0x16, 0xe8, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x07, 0x01, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x74, 0x07, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x08, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0,
+    0x08, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x08, 0x87, 0x80, 0x00, 0x01, 0x00,
+    0x00, 0x06, 0x08, 0x08, 0x47, 0xbf, 0x00, 0x01, 0x00, 0x03, 0xc6, 0x50, 0x08, 0x11, 0xfe,
+    0xff, 0x03, 0x03, 0xfb, 0xc1, 0x40, 0x07, 0x04, 0x69, 0xf0, 0xff, 0xfc, 0xf8, 0x05, 0x07,
+    0x01, 0x00, 0x0f, 0x83, 0x9f, 0x00, 0x04, 0x14, 0xd2, 0x22, 0x7e, 0xe0, 0x13, 0x3c, 0x00,
+    0x02, 0x13, 0x0f, 0x88, 0x8a, 0x13, 0x02, 0x80, 0x02, 0x18, 0x01, 0xc2, 0x22, 0x00, 0x00,
+    0x01, 0x80, 0x20, 0x22, 0x78, 0x02, 0x22, 0x1e, 0x8a, 0x23, 0x05, 0x82, 0x04, 0x23, 0x03,
+    0x42, 0x14, 0x32, 0xda, 0x50, 0x32, 0x3d, 0x40, 0x31, 0x0f, 0x41, 0x01, 0x42, 0x02, 0x60,
+    0x42, 0x02, 0xcc, 0x51, 0x9a, 0x51, 0xb1, 0x51, 0x30, 0x51, 0x20, 0x51, 0x20, 0x51, 0x20,
+    0x51, 0x20, 0x51, 0x40, 0x33, 0x07, 0x80, 0x40, 0x33, 0x1a, 0xe0, 0x40, 0x33, 0x6e, 0xd8,
+    0x40, 0x24, 0x01, 0xb3, 0xf6, 0x40, 0x24, 0x06, 0xc1, 0x8d, 0xc0, 0x24, 0x1b, 0x01, 0x13,
+    0x60, 0x24, 0x6c, 0x01, 0x00, 0x98, 0x24, 0xb0, 0x00, 0x44, 0x34, 0x15, 0x03, 0xc0, 0x00,
+    0x00, 0x4f, 0x16, 0x0f, 0x00, 0x01, 0x11, 0x53, 0xc0, 0x16, 0x3c, 0x00, 0x01, 0x00, 0x00,
+    0xf0, 0x16, 0xf0, 0x00, 0x01, 0x44, 0x44, 0x7c, 0x07, 0x03, 0xc0, 0x00, 0x01, 0x00, 0x40,
+    0x0f, 0x08, 0x0f, 0x00, 0x00, 0x01, 0x11, 0x51, 0x13, 0x40, 0x08, 0x3c, 0x00, 0x00, 0x03,
+    0x00, 0x40, 0x00, 0xd0, 0x08, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x08, 0x0f,
+    0x80, 0x00, 0x00, 0x00, 0x40, 0x07, 0xc0, 0x08, 0x34, 0x7f, 0x00, 0x01, 0x00, 0x43, 0xf8,
+    0xd0, 0x08, 0x0d, 0x00, 0xff, 0x03, 0x03, 0xbc, 0x03, 0x40, 0x07, 0x03, 0x40, 0x00, 0xff,
+    0xfc, 0x40, 0x0f, 0x16, 0xf0, 0x00, 0x01, 0x80, 0x40, 0x3c, 0x16, 0x3c, 0x00, 0x01, 0x00,
+    0x40, 0xf0, 0x16, 0x0f, 0x00, 0x01, 0x00, 0x43, 0xc0, 0x15, 0x03, 0xc0, 0x00, 0x00, 0xcf,
+    0x25, 0xb0, 0x00, 0x00, 0xf4, 0x02, 0x25, 0x6c, 0x00, 0x00, 0xd8, 0x01, 0x24, 0x1b, 0x00,
+    0x03, 0xe0, 0x23, 0x06, 0xc0, 0x0d, 0x24, 0x01, 0xb0, 0x36, 0x80, 0x33, 0x6c, 0xd8, 0x80,
+    0x33, 0x1b, 0x60, 0x80, 0x33, 0x07, 0x80, 0x80, 0x51, 0x80, 0x42, 0x01, 0x80, 0x42, 0x01,
+    0x80, 0x41, 0x01, 0x41, 0x03, 0x41, 0x02, 0x41, 0x04, 0x00, 0x41, 0x02, 0x41, 0x0c, 0x41,
+    0x18, 0x41, 0x03, 0x41, 0x06, 0x41, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x41, 0xc0, 0x32, 0x02, 0x30, 0x32, 0x03, 0x4c, 0x32, 0x01, 0x73, 0x33, 0x01, 0xed,
+    0xc0, 0x33, 0x01, 0xfd, 0xb0, 0x42, 0xbc, 0x7c, 0x42, 0xf5, 0x5b, 0x34, 0x01, 0xf1, 0x13,
+    0xc0, 0x34, 0x01, 0xd5, 0x55, 0xb0, 0x34, 0x01, 0xc4, 0x44, 0x7c, 0x34, 0x7e, 0xff, 0x15,
+    0x5b, 0x26, 0x7f, 0x81, 0x10, 0xaf, 0x13, 0x40, 0x17, 0x3f, 0x80, 0x03, 0x00, 0x41, 0xfd,
+    0x90, 0x08, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x04, 0x08, 0x40, 0x00, 0x00, 0x01,
+    0x00, 0x40, 0x00, 0x34, 0x53, 0x40, 0x00, 0xd0, 0x53, 0x40, 0x03, 0x40, 0x52, 0x40, 0x0f,
+    0x52, 0x40, 0x3c, 0x52, 0x40, 0xf0, 0x52, 0x43, 0xc0, 0x51, 0xcf, 0x52, 0xfc, 0x02, 0x51,
+    0xf0, 0x42, 0x03, 0x40, 0x42, 0x0f, 0x80, 0x42, 0x3c, 0x80, 0x42, 0xf0, 0x80, 0x42, 0xc0,
+    0x80, 0x33, 0x02, 0x00, 0x80, 0x33, 0x02, 0x00, 0x80, 0x33, 0x02, 0x01, 0x80, 0x33, 0x03,
+    0x01, 0x80, 0x32, 0x03, 0x01, 0x32, 0x01, 0x03, 0x32, 0x01, 0x02, 0x32, 0x01, 0x84, 0x41,
+    0xc8, 0x41, 0x72, 0x41, 0x0c, 0x41, 0x1a, 0x41, 0x1c, 0x41, 0x78, 0x41, 0x0a, 0x41, 0x04,
+    0x00, 0x00, 0x31, 0x20, 0x31, 0x10, 0x31, 0x10, 0x31, 0x18, 0x31, 0x08, 0x31, 0x08, 0x31,
+    0x08, 0x32, 0x0b, 0xc0, 0x32, 0x0e, 0x70, 0x32, 0x3d, 0x2c, 0x32, 0xf0, 0x3f, 0x24, 0x03,
+    0xc0, 0xaa, 0xc0, 0x24, 0x0f, 0x00, 0xfe, 0xf0, 0x24, 0x3c, 0x00, 0xa8, 0x0c, 0x24, 0x70,
+    0x00, 0xf8, 0xf2, 0x16, 0x01, 0x40, 0x00, 0xa0, 0xa8, 0x80, 0x16, 0x05, 0x00, 0x00, 0xe3,
+    0xff, 0x20, 0x16, 0x14, 0x00, 0x1f, 0x2a, 0xaa, 0x28, 0x16, 0x50, 0x03, 0xe0, 0x87, 0xfe,
+    0x0a, 0x08, 0x01, 0x40, 0x7c, 0x7f, 0xff, 0x6a, 0x02, 0x80, 0x08, 0x05, 0x0f, 0xff, 0x80,
+    0x01, 0xff, 0xf0, 0xa0, 0x08, 0x15, 0xcf, 0x80, 0x00, 0x00, 0x01, 0xf2, 0xe8, 0x08, 0x01,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x08, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x08, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x08, 0x04, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x20, 0x08, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x80, 0x16, 0x4c,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0x16, 0x13, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x16, 0x04, 0xc0,
+    0x00, 0x00, 0x03, 0xa0, 0x16, 0x01, 0x30, 0x00, 0x00, 0x0e, 0x80, 0x24, 0x4c, 0x00, 0x00,
+    0x3e, 0x24, 0x33, 0x00, 0x00, 0xfc, 0x24, 0x0c, 0xc0, 0x03, 0xf0, 0x24, 0x03, 0x30, 0x0f,
+    0xc0, 0x32, 0xcc, 0x3f, 0x32, 0x33, 0xfc, 0x32, 0x0c, 0xf0, 0x32, 0x01, 0xc0, 0x31, 0x02,
+    0x31, 0x02, 0x31, 0x03, 0x31, 0x03, 0x31, 0x01, 0x31, 0x01, 0x32, 0x01, 0x80, 0x41, 0xc8,
+    0x41, 0x70, 0x00, 0x41, 0x02, 0x41, 0x1c, 0x41, 0x7c, 0x41, 0x38, 0x21, 0x06, 0x23, 0x08,
+    0x00, 0x18, 0x22, 0x03, 0x80, 0x22, 0x06, 0xc0, 0x22, 0x04, 0x40, 0x22, 0x04, 0x20, 0x22,
+    0x04, 0x10, 0x22, 0x04, 0x10, 0x22, 0x08, 0x18, 0x22, 0x08, 0x08, 0x22, 0x08, 0x08, 0x32,
+    0x09, 0x80, 0x32, 0x0d, 0x20, 0x32, 0x15, 0x08, 0x32, 0x50, 0x8a, 0x32, 0x40, 0x28, 0x00,
+    0x42, 0xaa, 0x80, 0x51, 0x20, 0x42, 0xaa, 0x54, 0x33, 0x07, 0xa0, 0xaa, 0x33, 0x78, 0x1d,
+    0x55, 0x25, 0x07, 0x9f, 0xfe, 0x0a, 0xa0, 0x16, 0x40, 0x7b, 0xe0, 0x07, 0xe1, 0xfa, 0x08,
+    0x01, 0x43, 0xfc, 0x00, 0x00, 0x3e, 0xaa, 0x80, 0x08, 0x01, 0x33, 0x80, 0x00, 0x00, 0x01,
+    0xcf, 0x80, 0x08, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x08, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08,
+    0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x16, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xd2,
+    0x16, 0x05, 0xc0, 0x00, 0x00, 0x03, 0xe0, 0x24, 0xb0, 0x00, 0x00, 0x0f, 0x24, 0x5e, 0x00,
+    0x00, 0x7c, 0x24, 0x29, 0x80, 0x01, 0xb0, 0x24, 0x05, 0xf0, 0x0e, 0xc0, 0x23, 0x02, 0x9c,
+    0x33, 0x32, 0x5b, 0xcc, 0x32, 0x2b, 0x32, 0x32, 0x50, 0xca, 0x32, 0x10, 0x28, 0x32, 0x04,
+    0xa0, 0x32, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x41, 0x04, 0x41, 0x38, 0x41, 0x30, 0x21, 0x0c, 0x21, 0x16, 0x23, 0x08, 0x00, 0x10, 0x23,
+    0x03, 0x80, 0x20, 0x22, 0x06, 0xc0, 0x22, 0x04, 0x40, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04,
+    0x21, 0x08, 0x21, 0x08, 0x23, 0x08, 0x03, 0xc0, 0x32, 0x0d, 0x30, 0x23, 0x10, 0x16, 0xb8,
+    0x23, 0x10, 0x78, 0x16, 0x24, 0x11, 0xe0, 0x03, 0x80, 0x24, 0x12, 0x80, 0x01, 0xc0, 0x24,
+    0x1f, 0x00, 0x00, 0xb0, 0x24, 0x3c, 0x00, 0x00, 0x1c, 0x24, 0x50, 0x03, 0x80, 0x0a, 0x16,
+    0x01, 0xe0, 0x1c, 0x90, 0x01, 0x80, 0x16, 0x07, 0xa0, 0xe7, 0xf2, 0x00, 0xe0, 0x16, 0x0e,
+    0x27, 0x78, 0x1e, 0x40, 0x50, 0x16, 0x28, 0x3f, 0x80, 0x01, 0xe8, 0xa4, 0x16, 0xe1, 0xb8,
+    0x00, 0x00, 0x1c, 0x57, 0x08, 0x01, 0xcd, 0xc0, 0x00, 0x00, 0x01, 0x8a, 0x80, 0x07, 0x01,
+    0x4c, 0x40, 0x00, 0x00, 0x00, 0x31, 0x07, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x08, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x08, 0x01, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0x80, 0x08, 0x01, 0x56, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x80, 0x16, 0xf6,
+    0xc0, 0x00, 0x00, 0x03, 0x6b, 0x16, 0x20, 0x78, 0x00, 0x00, 0x1f, 0x14, 0x16, 0x0f, 0x77,
+    0x00, 0x00, 0xec, 0x50, 0x16, 0x07, 0x04, 0xe0, 0x07, 0x71, 0xe0, 0x16, 0x01, 0xd4, 0x7c,
+    0x39, 0x83, 0x80, 0x24, 0x51, 0x0b, 0xce, 0x0e, 0x24, 0x3a, 0xa0, 0x30, 0x3c, 0x24, 0x0c,
+    0x51, 0xc0, 0xf0, 0x24, 0x03, 0x27, 0x01, 0x40, 0x24, 0x01, 0x85, 0x07, 0x80, 0x32, 0x7f,
+    0x1e, 0x32, 0x1d, 0xe8, 0x32, 0x0d, 0x70, 0x32, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x30, 0x41, 0x20, 0x21, 0x18, 0x21, 0x0c,
+    0x21, 0x10, 0x00, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x02, 0x40,
+    0x32, 0x0a, 0x50, 0x23, 0x10, 0x08, 0xa0, 0x23, 0x10, 0x48, 0x52, 0x24, 0x11, 0x40, 0xaa,
+    0x80, 0x23, 0x11, 0x22, 0x55, 0x24, 0x18, 0x07, 0xaa, 0x90, 0x24, 0x28, 0x98, 0xb5, 0x54,
+    0x33, 0xe3, 0xd2, 0xa8, 0x16, 0x01, 0x03, 0x1c, 0x3a, 0x54, 0x80, 0x16, 0x05, 0x3c, 0xe0,
+    0x07, 0x6a, 0xa0, 0x16, 0x04, 0xc7, 0x00, 0x00, 0xed, 0x40, 0x16, 0x21, 0xb8, 0x00, 0x00,
+    0x1c, 0xa4, 0x16, 0xaf, 0xc0, 0x00, 0x00, 0x03, 0xd5, 0x16, 0xbe, 0x00, 0x00, 0x00, 0x00,
+    0x7a, 0x07, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x08, 0x05, 0x80, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0x80, 0x08, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x21, 0x40, 0x08,
+    0x04, 0x40, 0x80, 0x00, 0x00, 0x00, 0x02, 0x20, 0x16, 0x4c, 0x80, 0x00, 0x00, 0x00, 0x32,
+    0x16, 0x05, 0x80, 0x00, 0x00, 0x01, 0xb0, 0x16, 0xa6, 0x38, 0x00, 0x00, 0x1d, 0x81, 0x16,
+    0x25, 0x47, 0x80, 0x01, 0xfc, 0x04, 0x15, 0x07, 0xfb, 0x78, 0x1e, 0xe0, 0x16, 0x05, 0x50,
+    0x4f, 0xe7, 0x00, 0xa0, 0x16, 0x03, 0x71, 0xfc, 0x38, 0x00, 0x80, 0x24, 0x01, 0x51, 0xc0,
+    0x04, 0x24, 0x2f, 0xfc, 0x00, 0x14, 0x24, 0x09, 0x50, 0x00, 0x10, 0x33, 0xf0, 0x80, 0x80,
+    0x24, 0x01, 0x00, 0x82, 0x80, 0x32, 0x40, 0x82, 0x41, 0x50, 0x32, 0x0a, 0x10, 0x32, 0x02,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+    0x20, 0x21, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+    0x01, 0x80, 0x32, 0x05, 0x20, 0x32, 0x15, 0x08, 0x31, 0x12, 0x31, 0x17, 0x24, 0x02, 0x9a,
+    0xe0, 0x40, 0x23, 0x03, 0x67, 0xf8, 0x27, 0x03, 0x18, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x24,
+    0x16, 0xe0, 0x07, 0x80, 0x24, 0x1b, 0x00, 0x00, 0xe0, 0x24, 0x7c, 0x00, 0x00, 0x38, 0x15,
+    0x03, 0x60, 0x00, 0x00, 0x06, 0x16, 0x27, 0x80, 0x00, 0x00, 0x01, 0x84, 0x16, 0x16, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x16, 0x50, 0x40, 0x00, 0x00, 0x00, 0x08, 0x16, 0x40, 0x40, 0x00,
+    0x00, 0x00, 0x02, 0x21, 0x40, 0x21, 0x40, 0x08, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x17, 0x30, 0x80, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x07, 0x01, 0xc3, 0x00, 0x00, 0x00,
+    0x01, 0xcc, 0x16, 0x51, 0xfc, 0x00, 0x00, 0x3f, 0xc0, 0x16, 0x17, 0xfb, 0xe0, 0x87, 0xde,
+    0x04, 0x16, 0x27, 0x77, 0x1f, 0xf9, 0xe0, 0x04, 0x14, 0x03, 0xfc, 0x78, 0xde, 0x23, 0xd8,
+    0x8d, 0x60, 0x14, 0x02, 0x70, 0x00, 0x80, 0x14, 0x02, 0x02, 0x22, 0x80, 0x14, 0x02, 0x00,
+    0x00, 0x80, 0x15, 0x06, 0x00, 0x88, 0x80, 0x40, 0x15, 0x06, 0x02, 0x00, 0x00, 0x40, 0x13,
+    0x04, 0x00, 0x22, 0x14, 0x04, 0x00, 0x10, 0x08, 0x14, 0x04, 0x00, 0x14, 0x68, 0x32, 0x05,
+    0x20, 0x32, 0x01, 0x80, 0x21, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x32, 0x03, 0xc0, 0x32, 0x0e, 0x30, 0x32, 0x36, 0x0c, 0x32, 0xe7, 0x73,
+    0x24, 0x01, 0x78, 0x1c, 0x80, 0x24, 0x04, 0x60, 0x07, 0x20, 0x27, 0x17, 0x80, 0x01, 0xc8,
+    0x00, 0x00, 0x08, 0x27, 0x46, 0x00, 0x00, 0x72, 0x00, 0x00, 0x08, 0x24, 0xf8, 0x00, 0x00,
+    0x1d, 0x16, 0x02, 0xe0, 0x00, 0x00, 0x06, 0x40, 0x16, 0x09, 0x80, 0x00, 0x00, 0x01, 0x90,
+    0x16, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x64, 0x16, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x16,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x08, 0x01, 0xc0, 0x00, 0x00, 0x80, 0x00, 0x03, 0x80, 0x08, 0x03, 0xcf,
+    0x80, 0x00, 0x80, 0x01, 0xf3, 0x80, 0x16, 0xff, 0xff, 0x81, 0x81, 0xff, 0xf0, 0x15, 0x3a,
+    0x7c, 0x7f, 0xfe, 0x3e, 0x16, 0x10, 0x03, 0xe0, 0x47, 0xc0, 0x04, 0x16, 0x20, 0x88, 0x9f,
+    0x78, 0x00, 0x14, 0x16, 0x0a, 0x00, 0x00, 0x40, 0x00, 0x50, 0x16, 0x02, 0xa2, 0x22, 0x80,
+    0x01, 0x40, 0x24, 0xc0, 0x00, 0x80, 0x03, 0x15, 0x02, 0x58, 0x88, 0x80, 0x0a, 0x15, 0x02,
+    0x14, 0x00, 0x80, 0x28, 0x15, 0x06, 0x05, 0x22, 0x80, 0xa0, 0x15, 0x06, 0x01, 0xc0, 0x83,
+    0x80, 0x14, 0x04, 0x00, 0xf8, 0x8f, 0x14, 0x04, 0x00, 0x3c, 0xbc, 0x14, 0x04, 0x00, 0x0d,
+    0x70, 0x14, 0x08, 0x00, 0x03, 0xc0, 0x11, 0x08, 0x11, 0x18, 0x11, 0x10, 0x21, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x03, 0xc0,
+    0x32, 0x0f, 0xf0, 0x32, 0x3f, 0x4c, 0x32, 0xf3, 0xf3, 0x24, 0x03, 0xc1, 0x8c, 0xc0, 0x24,
+    0x0f, 0x01, 0x13, 0x30, 0x27, 0x3c, 0x01, 0x00, 0xcc, 0x00, 0x00, 0x08, 0x27, 0x70, 0x00,
+    0x44, 0x72, 0x00, 0x00, 0x08, 0x16, 0x01, 0x40, 0x00, 0x00, 0x0d, 0x80, 0x16, 0x05, 0x00,
+    0x01, 0x11, 0x13, 0x60, 0x16, 0x14, 0x00, 0x01, 0x00, 0x00, 0xd8, 0x16, 0x50, 0x00, 0x01,
+    0x44, 0x44, 0x76, 0x08, 0x01, 0x40, 0x00, 0x01, 0x00, 0x00, 0x0d, 0x80, 0x08, 0x05, 0x00,
+    0x00, 0x01, 0x11, 0x11, 0x13, 0xe0, 0x08, 0x14, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8,
+    0x08, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x08, 0x4f, 0xc0, 0x00, 0x01, 0x80,
+    0x00, 0x03, 0xc4, 0x08, 0x10, 0x3f, 0x80, 0x00, 0x80, 0x01, 0xfc, 0xf8, 0x08, 0x04, 0x00,
+    0x7f, 0x81, 0x81, 0xfe, 0x03, 0xe0, 0x08, 0x01, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x0d, 0x80,
+    0x16, 0x50, 0x00, 0x00, 0xc0, 0x00, 0x36, 0x16, 0x14, 0x00, 0x00, 0x80, 0x00, 0xd8, 0x16,
+    0x05, 0x00, 0x00, 0x80, 0x03, 0x60, 0x16, 0x01, 0x40, 0x00, 0x00, 0x0d, 0x80, 0x24, 0x70,
+    0x00, 0x00, 0x32, 0x24, 0x3c, 0x00, 0x00, 0xcc, 0x24, 0x0f, 0x00, 0x03, 0x30, 0x24, 0x03,
+    0xc0, 0x0c, 0xc0, 0x32, 0xf0, 0x33, 0x32, 0x3c, 0xcc, 0x32, 0x0f, 0x30, 0x32, 0x03, 0xc0,
+    0x11, 0x08, 0x11, 0x08, 0x11, 0x18, 0x11, 0x10, 0x11, 0x20, 0x11, 0x20, 0x32, 0x04, 0x80,
+    0x32, 0x14, 0x20, 0x32, 0x52, 0x88, 0x23, 0x01, 0x40, 0x72, 0x24, 0x05, 0x00, 0xee, 0x80,
+    0x24, 0x14, 0x00, 0xfa, 0x20, 0x27, 0x50, 0x01, 0xb4, 0x68, 0x00, 0x00, 0x08, 0x18, 0x01,
+    0x40, 0x01, 0xea, 0xa2, 0x00, 0x00, 0x08, 0x18, 0x05, 0x00, 0x00, 0xd1, 0x12, 0x80, 0x00,
+    0x08, 0x16, 0x14, 0x00, 0x00, 0xaa, 0xaa, 0x20, 0x16, 0x50, 0x00, 0x00, 0x44, 0x44, 0x68,
+    0x07, 0x01, 0x40, 0x00, 0xfe, 0xfe, 0xaa, 0xa2, 0x07, 0x05, 0x00, 0xff, 0x01, 0x12, 0xed,
+    0x12, 0x07, 0x14, 0x7f, 0x00, 0x03, 0x00, 0x03, 0xfa, 0x16, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0x08, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x08, 0x14, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x01, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x28, 0x16, 0x14, 0x00,
+    0x00, 0x00, 0x00, 0xa0, 0x16, 0x05, 0x00, 0x00, 0x00, 0x02, 0x80, 0x15, 0x01, 0x40, 0x00,
+    0x00, 0x0a, 0x24, 0x50, 0x00, 0x00, 0x28, 0x24, 0x14, 0x00, 0x00, 0xa0, 0x24, 0x05, 0x00,
+    0x02, 0x80, 0x23, 0x01, 0x40, 0x0a, 0x32, 0x50, 0x28, 0x32, 0x14, 0xa0, 0x32, 0x04, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x20, 0x11, 0x20, 0x11, 0x40,
+};
+
+static const struct delta_frame crystal_deltas[] = {
+    {0, 18, 69, 40, 0},
+    {3, 17, 66, 42, 210},
+    {3, 16, 66, 43, 398},
+    {3, 16, 66, 36, 614},
+    {4, 12, 64, 40, 824},
+    {0, 8, 67, 43, 1027},
+    {2, 7, 58, 54, 1255},
+    {1, 7, 61, 56, 1501},
+    {3, 7, 58, 57, 1676},
+    {5, 6, 54, 59, 1916},
+    {5, 5, 54, 61, 2121},
+    {5, 4, 54, 62, 2366},
+    {6, 4, 63, 48, 2596},
+    {3, 4, 66, 50, 2794},
+    {1, 4, 68, 52, 3027},
+    {3, 19, 66, 38, 3252},
+};
+
+const struct delta_anim crystal = {
+    .w = 69,
+    .h = 68,
+    .count = 16,
+    .keyframe = crystal_keyframe,
+    .deltas = crystal_deltas,
+    .data = crystal_delta_data,
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+// One animation step: XOR data that turns the previous frame into the next, and the pixel
+// rectangle it touches. The data holds one header byte per row of the rectangle, with the first
+// changed byte column in the high nibble and the changed byte count in the low nibble, followed by
+// that many XOR bytes.
+struct delta_frame {
+    uint8_t x;
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+    uint16_t offset;
+};
+
+// Packed 1bpp animation generated by scripts/delta_anim.py. deltas[i] turns frame i into frame
+// (i + 1) % count, starting from the keyframe, which is frame 0 without a palette, run-length
+// coded like struct rle_image with set bits for the foreground.
+struct delta_anim {
+    uint16_t w;
+    uint16_t h;
+    uint8_t count;
+    const uint8_t *keyframe;
+    const struct delta_frame *deltas;
+    const uint8_t *data;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Run-length coded 1bpp image generated by scripts/img_convert.py --rle. The data codes packed
+// MSB-first rows as one stream: a control byte c < 0x80 is followed by c + 1 literal bytes, and a
+// control byte c >= 0x80 stands for c - 0x7F zero bytes. Images that would not get smaller are
+// raw instead, with the packed rows stored as they are. Set bits are foreground pixels, or
+// background pixels if inverted.
+struct rle_image {
+    uint8_t w;
+    uint8_t h;
+    bool inverted;
+    bool raw;
+    const uint8_t *data;
+};
+
+#define RLE_IMAGE_DECLARE(name) extern const struct rle_image name
@@ -16,7 +16,9 @@ lv_obj_t *zmk_display_status_screen() {
 
 #if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_STATUS)
     zmk_widget_screen_init(&screen_widget, screen);
+#if !IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
     lv_obj_align(zmk_widget_screen_obj(&screen_widget), LV_ALIGN_TOP_LEFT, 0, 0);
+#endif
 #endif
 
     return screen;
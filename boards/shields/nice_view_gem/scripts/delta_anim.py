@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Encode LVGL indexed 1bit animation frames as a keyframe plus XOR deltas.
+
+Reads the frames of an LVGL image converter output (such as assets/crystal.c) in declaration
+order and writes a C source defining a `struct delta_anim` (see assets/delta_anim.h):
+
+    scripts/delta_anim.py assets/crystal.c crystal assets/crystal_delta.c
+
+The keyframe is run-length coded like `img_convert.py --rle` images, with set bits for the
+foreground. Delta i turns frame i into frame (i + 1) % count, so playback loops without a second
+keyframe.
+Each delta stores one header byte per row of its dirty rectangle (first changed byte column in
+the high nibble, number of changed bytes in the low nibble) followed by that many XOR bytes.
+"""
+
+import re
+import sys
+
+from img_convert import encode_rle
+
+IMAGE_RE = re.compile(r"uint8_t\s+(\w+)_map\[\]\s*=\s*\{(.*?)\n\};", re.S)
+HEADER_RE = re.compile(r"const lv_img_dsc_t (\w+) = \{(.*?)\};", re.S)
+
+
+def parse_frames(source):
+    headers = {}
+    for name, body in HEADER_RE.findall(source):
+        fields = dict(re.findall(r"\.header\.(\w+)\s*=\s*(\w+)", body))
+        if fields.get("cf") != "LV_IMG_CF_INDEXED_1BIT":
+            sys.exit(f"{name}: only LV_IMG_CF_INDEXED_1BIT images are supported")
+        headers[name] = (int(fields["w"]), int(fields["h"]))
+
+    frames = []
+    for name, body in IMAGE_RE.findall(source):
+        # Skip the palette, which the player sets from the widget colors
+        pixels = body.split("#endif", 1)[1]
+        data = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", pixels))
+        frames.append((name, headers[name], data))
+
+    sizes = {size for _, size, _ in frames}
+    if len(sizes) != 1:
+        sys.exit(f"frames differ in size: {sorted(sizes)}")
+
+    return sizes.pop(), [data for _, _, data in frames]
+
+
+def encode_delta(prev, frame, w, h):
+    stride = (w + 7) // 8
+    xor = bytes(a ^ b for a, b in zip(prev, frame))
+    rows = [y for y in range(h) if any(xor[y * stride : (y + 1) * stride])]
+    if not rows:
+        return (0, 0, 0, 0), b""
+
+    y0, y1 = rows[0], rows[-1]
+    x0, x1 = w, 0
+    data = bytearray()
+    for y in range(y0, y1 + 1):
+        row = xor[y * stride : (y + 1) * stride]
+        cols = [c for c in range(stride) if row[c]]
+        if not cols:
+            data.append(0)
+            continue
+
+        start, end = cols[0], cols[-1]
+        data.append(start << 4 | (end - start + 1))
+        data += row[start : end + 1]
+
+        bits = [c * 8 + b for c in (start, end) for b in range(8) if row[c] & (0x80 >> b)]
+        x0, x1 = min(x0, bits[0]), max(x1, bits[-1])
+
+    return (x0, y0, x1 - x0 + 1, y1 - y0 + 1), bytes(data)
+
+
+def format_bytes(data, indent="    "):
+    lines = []
+    for i in range(0, len(data), 15):
+        lines.append(indent + " ".join(f"0x{b:02x}," for b in data[i : i + 15]))
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(f"usage: {sys.argv[0]} <frames.c> <name> <output.c>")
+
+    source_path, name, output_path = sys.argv[1:]
+    with open(source_path) as f:
+        (w, h), frames = parse_frames(f.read())
+
+    if (w + 7) // 8 > 15:
+        sys.exit("frames wider than 120 pixels do not fit the row header")
+
+    deltas = []
+    data = bytearray()
+    for i, frame in enumerate(frames):
+        rect, delta = encode_delta(frame, frames[(i + 1) % len(frames)], w, h)
+        deltas.append((rect, len(data)))
+        data += delta
+
+    keyframe = encode_rle(frames[0])
+    with open(output_path, "w", newline="\n") as f:
+        f.write(f"// Generated by scripts/delta_anim.py from {source_path.split('/')[-1]}.\n")
+        f.write("// Do not edit; re-run the script after changing the frames.\n\n")
+        f.write('#include <lvgl.h>\n#include "delta_anim.h"\n\n')
+        f.write(f"static const LV_ATTRIBUTE_LARGE_CONST uint8_t {name}_keyframe[] = {{\n")
+        f.write(format_bytes(keyframe) + "\n};\n\n")
+        f.write(f"static const LV_ATTRIBUTE_LARGE_CONST uint8_t {name}_delta_data[] = {{\n")
+        f.write(format_bytes(data) + "\n};\n\n")
+        f.write(f"static const struct delta_frame {name}_deltas[] = {{\n")
+        for (x, y, dw, dh), offset in deltas:
+            f.write(f"    {{{x}, {y}, {dw}, {dh}, {offset}}},\n")
+        f.write("};\n\n")
+        f.write(f"const struct delta_anim {name} = {{\n")
+        f.write(f"    .w = {w},\n    .h = {h},\n    .count = {len(frames)},\n")
+        f.write(f"    .keyframe = {name}_keyframe,\n")
+        f.write(f"    .deltas = {name}_deltas,\n")
+        f.write(f"    .data = {name}_delta_data,\n")
+        f.write("};\n")
+
+    total = len(keyframe) + len(data) + 6 * len(deltas)
+    print(f"{name}: {len(frames)} frames, {total} bytes (was {len(frames) * (len(frames[0]) + 8)})")
+
+
+if __name__ == "__main__":
+    main()
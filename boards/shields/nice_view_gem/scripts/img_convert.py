@@ -0,0 +1,395 @@
+#!/usr/bin/env python3
+"""Convert 2 color PNGs to LVGL indexed 1bit or run-length coded images.
+
+Writes a C source with one `<name>_map` array and `lv_img_dsc_t <name>` per PNG, named after the
+file, in the same layout as the LVGL image converter:
+
+    scripts/img_convert.py images.c assets/images/bolt.png assets/images/bt.png ...
+
+Palette PNGs keep their palette order and pixel indices, so an image round-trips byte for byte.
+Other PNGs are split at 50% luminance into index 0 (white) and index 1 (black), and pixels below
+50% alpha use a transparent index 0. CONFIG_NICE_VIEW_WIDGET_INVERTED swaps the two palette
+entries.
+
+With `--rle` each image is written as a `struct rle_image` (see assets/rle_image.h) instead, which
+is how the build generates images.c from assets/images/*.png. Rows are coded as zero runs and
+literal bytes, storing whichever of the foreground and background pixels comes out smaller, or
+kept raw if coding does not make them smaller. A report of the flash used, descriptors included,
+is printed. Run-length images must be opaque.
+
+`extract` goes the other way and writes every image of a C source as an indexed PNG, which is how
+assets/images/ was created from the hand-pasted arrays, and reads LVGL image converter output too:
+
+    scripts/img_convert.py extract images.c assets/images
+"""
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+WHITE = (0xFF, 0xFF, 0xFF, 0xFF)
+BLACK = (0x00, 0x00, 0x00, 0xFF)
+
+IMAGE_RE = re.compile(r"uint8_t\s+(\w+)_map\[\]\s*=\s*\{(.*?)\n\};", re.S)
+HEADER_RE = re.compile(r"const lv_img_dsc_t (\w+) = \{(.*?)\};", re.S)
+COLOR_RE = re.compile(r"((?:0x[0-9a-fA-F]{2},\s*){4})/\*Color of index \d\*/")
+
+# Flash for each image besides its pixels on a 32 bit target: the palette and lv_img_dsc_t of an
+# indexed image, and the struct rle_image of a run-length one
+INDEXED_PALETTE_SIZE = 8
+INDEXED_DESCRIPTOR_SIZE = 12
+RLE_DESCRIPTOR_SIZE = 8
+
+
+class Image:
+    def __init__(self, name, w, h, palette, pixels):
+        self.name = name
+        self.w = w
+        self.h = h
+        # Two (r, g, b, a) entries, in the non-inverted order
+        self.palette = palette
+        # Rows of palette indices
+        self.pixels = pixels
+
+    def foreground(self):
+        # Dark palette entries are the foreground, black unless CONFIG_NICE_VIEW_WIDGET_INVERTED
+        if any(color[3] < 0x80 for color in self.palette):
+            sys.exit(f"{self.name}: run-length images cannot be transparent")
+        dark = [(r * 299 + g * 587 + b * 114) // 1000 < 0x80 for r, g, b, _ in self.palette]
+        pixels = [[int(dark[index]) for index in row] for row in self.pixels]
+        return Image(self.name, self.w, self.h, [WHITE, BLACK], pixels)
+
+    def inverted(self):
+        pixels = [[1 - index for index in row] for row in self.pixels]
+        return Image(self.name, self.w, self.h, self.palette[::-1], pixels)
+
+    def packed(self):
+        data = bytearray()
+        for row in self.pixels:
+            for x in range(0, self.w, 8):
+                byte = 0
+                for bit, index in enumerate(row[x : x + 8]):
+                    byte |= index << (7 - bit)
+                data.append(byte)
+        return bytes(data)
+
+
+# PNG
+
+
+def png_chunks(data):
+    if data[:8] != PNG_SIGNATURE:
+        raise ValueError("not a PNG file")
+
+    pos = 8
+    while pos < len(data):
+        (length,) = struct.unpack(">I", data[pos : pos + 4])
+        kind = data[pos + 4 : pos + 8]
+        yield kind, data[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+
+
+def unfilter(raw, stride, h, bpp):
+    rows = []
+    prev = bytearray(stride)
+    pos = 0
+    for _ in range(h):
+        kind = raw[pos]
+        row = bytearray(raw[pos + 1 : pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = row[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                row[i] = (row[i] + a) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + b) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                row[i] = (row[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(row)
+        prev = row
+    return rows
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        chunks = list(png_chunks(f.read()))
+
+    header = dict(chunks)[b"IHDR"]
+    w, h, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", header)
+    if interlace:
+        raise ValueError(f"{path}: interlaced PNGs are not supported")
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    if color_type != 3 and depth != 8:
+        raise ValueError(f"{path}: only 8 bit grayscale and RGB PNGs are supported")
+
+    raw = zlib.decompress(b"".join(data for kind, data in chunks if kind == b"IDAT"))
+    rows = unfilter(raw, (w * channels * depth + 7) // 8, h, max(1, channels * depth // 8))
+    name = os.path.splitext(os.path.basename(path))[0]
+
+    if color_type == 3:
+        plte = dict(chunks)[b"PLTE"]
+        alpha = dict(chunks).get(b"tRNS", b"")
+        palette = [
+            (*plte[i * 3 : i * 3 + 3], alpha[i] if i < len(alpha) else 0xFF)
+            for i in range(len(plte) // 3)
+        ]
+        mask = (1 << depth) - 1
+        pixels = []
+        for row in rows:
+            indices = []
+            for x in range(w):
+                bit = x * depth
+                indices.append((row[bit // 8] >> (8 - depth - bit % 8)) & mask)
+            pixels.append(indices)
+        if len(palette) > 2 and max(max(r) for r in pixels) > 1:
+            raise ValueError(f"{path}: uses more than 2 palette entries")
+        return Image(name, w, h, (palette + [WHITE, WHITE])[:2], pixels)
+
+    pixels = []
+    transparent = False
+    for row in rows:
+        indices = []
+        for x in range(w):
+            px = row[x * channels : (x + 1) * channels]
+            gray = px[0] if channels < 3 else (px[0] * 299 + px[1] * 587 + px[2] * 114) // 1000
+            opaque = channels in (1, 3) or px[-1] >= 0x80
+            transparent |= not opaque
+            indices.append(1 if opaque and gray < 0x80 else 0)
+        pixels.append(indices)
+    return Image(name, w, h, [WHITE[:3] + (0x00 if transparent else 0xFF,), BLACK], pixels)
+
+
+def png_chunk(kind, data):
+    return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data))
+
+
+def write_png(path, image):
+    stride = (image.w + 7) // 8
+    packed = image.packed()
+    raw = b"".join(b"\x00" + packed[y * stride : (y + 1) * stride] for y in range(image.h))
+    plte = bytes(c for color in image.palette for c in color[:3])
+    alpha = bytes(color[3] for color in image.palette)
+
+    with open(path, "wb") as f:
+        f.write(PNG_SIGNATURE)
+        f.write(png_chunk(b"IHDR", struct.pack(">IIBBBBB", image.w, image.h, 1, 3, 0, 0, 0)))
+        f.write(png_chunk(b"PLTE", plte))
+        if alpha != b"\xff\xff":
+            f.write(png_chunk(b"tRNS", alpha))
+        f.write(png_chunk(b"IDAT", zlib.compress(raw, 9)))
+        f.write(png_chunk(b"IEND", b""))
+
+
+# C source
+
+
+def parse_source(source):
+    headers = {}
+    for name, body in HEADER_RE.findall(source):
+        fields = dict(re.findall(r"\.header\.(\w+)\s*=\s*(\w+)", body))
+        if fields.get("cf") != "LV_IMG_CF_INDEXED_1BIT":
+            sys.exit(f"{name}: only LV_IMG_CF_INDEXED_1BIT images are supported")
+        headers[name] = (int(fields["w"]), int(fields["h"]))
+
+    images = []
+    for name, body in IMAGE_RE.findall(source):
+        w, h = headers[name]
+        # The #else branch holds the non-inverted palette, stored as b, g, r, a
+        normal = body.split("#else", 1)[1].split("#endif", 1)[0]
+        palette = []
+        for color in COLOR_RE.findall(normal):
+            b, g, r, a = (int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", color))
+            palette.append((r, g, b, a))
+
+        pixels = body.split("#endif", 1)[1]
+        data = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", pixels))
+        stride = (w + 7) // 8
+        rows = [
+            [(data[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(w)] for y in range(h)
+        ]
+        images.append(Image(name, w, h, palette, rows))
+
+    return images
+
+
+def format_bytes(data, indent):
+    # clang-format's column layout: as few lines as fit in 100 columns, then as few columns as
+    # still give that many lines
+    max_columns = (100 - len(indent) + 1) // 6
+    lines = -(-len(data) // max_columns)
+    columns = -(-len(data) // lines)
+    return "\n".join(
+        indent + " ".join(f"0x{b:02x}," for b in data[i : i + columns])
+        for i in range(0, len(data), columns)
+    )
+
+
+def format_palette(palette, indent):
+    lines = []
+    for i, (r, g, b, a) in enumerate(palette):
+        lines.append(f"{indent}0x{b:02x}, 0x{g:02x}, 0x{r:02x}, 0x{a:02x}, /*Color of index {i}*/")
+    return "\n".join(lines)
+
+
+def encode_rle(data):
+    """Codes bytes as runs: control byte c < 0x80 is followed by c + 1 literal bytes, and control
+    byte c >= 0x80 stands for c - 0x7F zero bytes."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        end = i
+        if data[i] == 0:
+            while end < len(data) and data[end] == 0 and end - i < 128:
+                end += 1
+            out.append(0x80 + end - i - 1)
+        else:
+            # A single zero byte is cheaper inside a literal than as a run of its own
+            while end < len(data) and end - i < 128 and any(data[end : end + 2]):
+                end += 1
+            out.append(end - i - 1)
+            out += data[i:end]
+        i = end
+    return bytes(out)
+
+
+def format_rle_image(image):
+    # Of the two polarities, set bits mark the pixels that code smaller
+    foreground = image.foreground()
+    packed = foreground.packed()
+    data = encode_rle(packed)
+    background = encode_rle(foreground.inverted().packed())
+    inverted = len(background) < len(data)
+    if inverted:
+        data = background
+
+    # Raw rows draw faster, so they are kept unless coding saves a byte
+    raw = len(data) >= len(packed)
+    if raw:
+        data = packed
+        inverted = False
+
+    before = len(packed) + INDEXED_PALETTE_SIZE + INDEXED_DESCRIPTOR_SIZE
+    after = len(data) + RLE_DESCRIPTOR_SIZE
+    kind = "raw" if raw else "coded"
+    print(f"{image.name}: {image.w}x{image.h} {kind}, {before} -> {after} bytes")
+    source = "\n".join(
+        [
+            f"static const LV_ATTRIBUTE_LARGE_CONST uint8_t {image.name}_data[] = {{",
+            format_bytes(data, "    "),
+            "};",
+            "",
+            f"const struct rle_image {image.name} = {{",
+            f"    .w = {image.w},",
+            f"    .h = {image.h},",
+            f"    .inverted = {'true' if inverted else 'false'},",
+            f"    .raw = {'true' if raw else 'false'},",
+            f"    .data = {image.name}_data,",
+            "};",
+        ]
+    )
+    return source, before, after
+
+
+def format_image(image):
+    attribute = f"LV_ATTRIBUTE_IMG_{image.name.upper()}"
+    data = image.packed()
+    decl = f"const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attribute} uint8_t"
+    indent = "    "
+
+    # Wrapped like clang-format does at 100 columns
+    if len(f"{decl} {image.name}_map[] = {{") <= 100:
+        decl = f"{decl} {image.name}_map[] = {{"
+    else:
+        decl = f"{decl}\n    {image.name}_map[] = {{"
+        indent = "        "
+
+    return "\n".join(
+        [
+            f"#ifndef {attribute}",
+            f"#define {attribute}",
+            "#endif",
+            "",
+            decl,
+            "#if CONFIG_NICE_VIEW_WIDGET_INVERTED",
+            format_palette(image.palette[::-1], indent),
+            "#else",
+            format_palette(image.palette, indent),
+            "#endif",
+            "",
+            format_bytes(data, indent),
+            "};",
+            "",
+            f"const lv_img_dsc_t {image.name} = {{",
+            "    .header.cf = LV_IMG_CF_INDEXED_1BIT,",
+            "    .header.always_zero = 0,",
+            "    .header.reserved = 0,",
+            f"    .header.w = {image.w},",
+            f"    .header.h = {image.h},",
+            f"    .data_size = {len(data) + 8},",
+            f"    .data = {image.name}_map,",
+            "};",
+        ]
+    )
+
+
+def generate(output_path, png_paths, rle):
+    images = [read_png(path) for path in png_paths]
+
+    if rle:
+        sources, before, after = zip(*(format_rle_image(image) for image in images))
+        # Compared with indexed images with their palettes and descriptors
+        print(f"{len(images)} images: {sum(before)} -> {sum(after)} bytes of flash")
+        with open(output_path, "w", newline="\n") as f:
+            f.write(
+                "// Generated by scripts/img_convert.py. Do not edit; change assets/images/.\n\n"
+            )
+            f.write('#include <lvgl.h>\n#include "rle_image.h"\n\n')
+            f.write("\n\n".join(sources) + "\n")
+        return
+
+    with open(output_path, "w", newline="\n") as f:
+        f.write("#include <lvgl.h>\n\n")
+        f.write("#ifndef LV_ATTRIBUTE_MEM_ALIGN\n#define LV_ATTRIBUTE_MEM_ALIGN\n#endif\n\n")
+        f.write("\n\n".join(format_image(image) for image in images))
+
+
+def extract(source_path, output_dir):
+    with open(source_path) as f:
+        images = parse_source(f.read())
+
+    os.makedirs(output_dir, exist_ok=True)
+    for image in images:
+        write_png(os.path.join(output_dir, f"{image.name}.png"), image)
+        print(f"{image.name}: {image.w}x{image.h}")
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 3 and args[0] == "extract":
+        extract(args[1], args[2])
+        return
+
+    rle = "--rle" in args
+    if rle:
+        args.remove("--rle")
+    if len(args) < 2:
+        sys.exit(
+            f"usage: {sys.argv[0]} [--rle] <output.c> <image.png>...\n"
+            f"       {sys.argv[0]} extract <images.c> <output dir>"
+        )
+
+    generate(args[0], args[1:], rle)
+
+
+if __name__ == "__main__":
+    main()
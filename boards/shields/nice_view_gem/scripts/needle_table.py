@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Generate the WPM needle position table included by widgets/wpm.c.
+
+The needle runs from WPM_NEEDLE_INNER to WPM_NEEDLE_OUTER pixels out from the gauge centre, at
+225 + fraction * 90 degrees for a fraction of the sweep. Its truncated end points only change at
+a few dozen angles, so instead of evaluating cosf() and sinf() per render, the gauge looks up the
+last position starting at or before the fraction:
+
+    scripts/needle_table.py widgets/layout.h wpm_needle.h
+
+The radii are read from layout.h. Every step is evaluated in single precision, rounding after
+each operation like the float expressions the gauge used to run, so the table is pixel-identical
+to them. tests/needle_test.c checks that against the C library.
+"""
+
+import math
+import re
+import struct
+import sys
+
+# Fractions are in 1/2^FRACTION_BITS of the sweep, which fit 32 bits shifted from 8 bit WPM values
+FRACTION_BITS = 24
+FULL = 1 << FRACTION_BITS
+# One degree, closer than any coordinate changes twice
+SCAN_STEPS = 90
+
+DEFINE_RE = r"#define\s+{}\s+([0-9.]+)f?\b"
+
+
+def f32(x):
+    return struct.unpack("f", struct.pack("f", x))[0]
+
+
+def read_define(layout, name):
+    match = re.search(DEFINE_RE.format(name), layout)
+    if match is None:
+        sys.exit(f"{name} not found")
+    return match.group(1)
+
+
+class Needle:
+    def __init__(self, inner, outer):
+        self.inner = f32(inner)
+        self.outer = f32(outer)
+        self.deg_to_rad = f32(f32(3.14159) / f32(180.0))
+
+    def at(self, fraction):
+        # float angleDeg = 225 + ((float)fraction / NEEDLE_FULL) * 90;
+        deg = f32(225 + f32(f32(fraction) / FULL * 90))
+        rad = f32(deg * self.deg_to_rad)
+        cos = f32(math.cos(rad))
+        sin = f32(math.sin(rad))
+        # (int) truncates towards zero, like int()
+        return (
+            int(f32(self.inner * cos)),
+            int(f32(self.inner * sin)),
+            int(f32(self.outer * cos)),
+            int(f32(self.outer * sin)),
+        )
+
+    def table(self):
+        # Scans the sweep a degree at a time and bisects each step for the exact fractions where
+        # the position changes
+        current = self.at(0)
+        positions = [(0, current)]
+
+        for i in range(1, SCAN_STEPS + 1):
+            lo = (i - 1) * FULL // SCAN_STEPS
+            hi = i * FULL // SCAN_STEPS
+            end = self.at(hi)
+
+            while end != current:
+                a, b = lo, hi
+                while b - a > 1:
+                    mid = a + (b - a) // 2
+                    if self.at(mid) == current:
+                        a = mid
+                    else:
+                        b = mid
+
+                current = self.at(b)
+                positions.append((b, current))
+                lo = b
+
+        return positions
+
+
+def generate(layout_path, output):
+    with open(layout_path) as f:
+        layout = f.read()
+
+    inner = read_define(layout, "WPM_NEEDLE_INNER")
+    outer = read_define(layout, "WPM_NEEDLE_OUTER")
+    positions = Needle(float(inner), float(outer)).table()
+
+    lines = [
+        "// Generated by scripts/needle_table.py from layout.h, do not edit",
+        "",
+        f"// WPM_NEEDLE_INNER {inner}, WPM_NEEDLE_OUTER {outer}",
+        f"#define NEEDLE_FRACTION_BITS {FRACTION_BITS}",
+        "",
+        "static const struct needle_position needle_positions[] = {",
+    ]
+    for fraction, (start_x, start_y, end_x, end_y) in positions:
+        lines.append(f"    {{0x{fraction:06x}, {start_x}, {start_y}, {end_x}, {end_y}}},")
+    lines.append("};")
+
+    with open(output, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+    print(f"{len(positions)} needle positions")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(f"usage: {sys.argv[0]} <layout.h> <output.h>")
+
+    generate(sys.argv[1], sys.argv[2])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,31 @@
+#pragma once
+
+// Timing for the host benchmarks. Each measurement is the average of a batch of calls, taking the
+// fastest of several batches as the one least disturbed by the rest of the host.
+
+#include <stdint.h>
+#include <time.h>
+
+#define BENCH_BATCHES 5
+
+static inline double bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Nanoseconds per call of fn(arg), over batches of repeats calls
+static inline double bench_ns(void (*fn)(void *), void *arg, uint32_t repeats) {
+    double best = 0;
+
+    for (int b = 0; b < BENCH_BATCHES; b++) {
+        double start = bench_now_ns();
+        for (uint32_t r = 0; r < repeats; r++) {
+            fn(arg);
+        }
+        double ns = (bench_now_ns() - start) / repeats;
+        best = (b == 0 || ns < best) ? ns : best;
+    }
+
+    return best;
+}
@@ -0,0 +1,95 @@
+/*
+ * Times every frame of a spin of the procedural crystal (widgets/crystal.c) on the host:
+ *
+ *     build/crystal_bench [frames] [--print]
+ *
+ * The spin has 16 frames by default, and --print shows each frame as text. The run fails unless
+ * the slowest frame takes at most CRYSTAL_HOST_BUDGET_NS of host time. That is a host-time bound,
+ * which catches a renderer that gets several times slower, and not the CRYSTAL_BUDGET_US of the
+ * keyboard: host and Cortex-M4 times have no fixed ratio, so the frame time on the keyboard is
+ * only known from the animation figure of CONFIG_NICE_VIEW_GEM_RENDER_STATS.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "crystal.h"
+
+// Over three times the slowest frame measured on an x86-64 Xeon host at -O2, 0.9-1.5 us per run
+#ifndef CRYSTAL_HOST_BUDGET_NS
+#define CRYSTAL_HOST_BUDGET_NS 5000
+#endif
+
+#define STRIDE ((CRYSTAL_WIDTH + 7) / 8)
+#define REPEATS 400
+
+static uint8_t pixels[STRIDE * CRYSTAL_HEIGHT];
+
+struct frame {
+    uint16_t index;
+    uint16_t count;
+    uint32_t calls;
+};
+
+// Alternates between the frame and the one before it, so every call renders from the previous
+// frame as the animation does
+static void run_frame(void *arg) {
+    struct frame *frame = arg;
+    uint16_t previous = (frame->index + frame->count - 1) % frame->count;
+    struct crystal_rect rect;
+
+    crystal_render(pixels, frame->calls++ % 2 ? previous : frame->index, frame->count, &rect);
+}
+
+static void print_frame(uint16_t index, const struct crystal_rect *rect) {
+    printf("frame %u, changed %u,%u %ux%u\n", index, rect->x, rect->y, rect->w, rect->h);
+    for (int y = 0; y < CRYSTAL_HEIGHT; y++) {
+        for (int x = 0; x < CRYSTAL_WIDTH; x++) {
+            putchar(pixels[y * STRIDE + x / 8] & (0x80 >> (x % 8)) ? '#' : '.');
+        }
+        putchar('\n');
+    }
+}
+
+int main(int argc, char **argv) {
+    uint16_t count = 16;
+    bool print = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--print") == 0) {
+            print = true;
+        } else {
+            count = atoi(argv[i]);
+        }
+    }
+    if (count < 1) {
+        fprintf(stderr, "usage: %s [frames] [--print]\n", argv[0]);
+        return 2;
+    }
+
+    struct crystal_rect rect;
+    double worst = 0, total = 0;
+
+    for (uint16_t index = 0; index < count; index++) {
+        struct frame frame = {.index = index, .count = count};
+
+        crystal_render(pixels, (index + count - 1) % count, count, &rect);
+        double ns = bench_ns(run_frame, &frame, REPEATS);
+
+        crystal_render(pixels, index, count, &rect);
+        if (print) {
+            print_frame(index, &rect);
+        }
+
+        total += ns;
+        worst = ns > worst ? ns : worst;
+    }
+
+    bool ok = worst <= CRYSTAL_HOST_BUDGET_NS;
+    printf("crystal: %u frames, %.0f ns average, %.0f ns worst, host budget %d ns: %s\n", count,
+           total / count, worst, CRYSTAL_HOST_BUDGET_NS, ok ? "ok" : "over budget");
+
+    return ok ? 0 : 1;
+}
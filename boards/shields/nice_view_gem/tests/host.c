@@ -0,0 +1,469 @@
+#include <stdarg.h>
+#include <time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/settings/settings.h>
+#include <lvgl.h>
+#include <zmk/battery.h>
+#include <zmk/ble.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
+#include <zmk/events/battery_state_changed.h>
+#include <zmk/events/ble_active_profile_changed.h>
+#include <zmk/events/endpoint_changed.h>
+#include <zmk/events/layer_state_changed.h>
+#include <zmk/events/usb_conn_state_changed.h>
+#include <zmk/events/wpm_state_changed.h>
+#include <zmk/keymap.h>
+#include <zmk/usb.h>
+#include <zmk/wpm.h>
+#include "host.h"
+
+/**
+ * Clock and work queue
+ **/
+
+static int64_t now;
+static struct k_work_q display_queue;
+static struct k_work *queue_head, *queue_tail;
+static struct k_work_delayable *timers;
+
+long long k_uptime_get(void) { return now; }
+
+void k_work_init(struct k_work *work, k_work_handler_t handler) {
+    *work = (struct k_work){.handler = handler};
+}
+
+int k_work_submit_to_queue(struct k_work_q *queue, struct k_work *work) {
+    if (work->queued) {
+        return 0;
+    }
+
+    work->queued = true;
+    work->next = NULL;
+    if (queue_tail != NULL) {
+        queue_tail->next = work;
+    } else {
+        queue_head = work;
+    }
+    queue_tail = work;
+
+    return 1;
+}
+
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler) {
+    *dwork = (struct k_work_delayable){.work = {.handler = handler}};
+}
+
+// Like Zephyr, scheduling work that is already scheduled or queued leaves it as it is
+int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork,
+                              k_timeout_t delay) {
+    if (k_work_delayable_is_pending(dwork)) {
+        return 0;
+    }
+
+    if (delay.ms <= 0) {
+        return k_work_submit_to_queue(queue, &dwork->work);
+    }
+
+    dwork->due = now + delay.ms;
+    dwork->scheduled = true;
+    if (!dwork->registered) {
+        dwork->registered = true;
+        dwork->next_timer = timers;
+        timers = dwork;
+    }
+
+    return 1;
+}
+
+bool k_work_delayable_is_pending(const struct k_work_delayable *dwork) {
+    return dwork->scheduled || dwork->work.queued;
+}
+
+int64_t host_work_cpu_ns;
+int64_t host_work_started_ns;
+
+int64_t host_cpu_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void run_queue(void) {
+    while (queue_head != NULL) {
+        struct k_work *work = queue_head;
+
+        queue_head = work->next;
+        if (queue_head == NULL) {
+            queue_tail = NULL;
+        }
+        work->queued = false;
+        host_work_started_ns = host_cpu_ns();
+        work->handler(work);
+        host_work_cpu_ns += host_cpu_ns() - host_work_started_ns;
+    }
+}
+
+static struct k_work_delayable *next_timer(void) {
+    struct k_work_delayable *next = NULL;
+
+    for (struct k_work_delayable *timer = timers; timer != NULL; timer = timer->next_timer) {
+        if (timer->scheduled && (next == NULL || timer->due < next->due)) {
+            next = timer;
+        }
+    }
+
+    return next;
+}
+
+void host_run_until(int64_t until) {
+    struct k_work_delayable *timer;
+
+    run_queue();
+    while ((timer = next_timer()) != NULL && timer->due <= until) {
+        now = MAX(now, timer->due);
+        timer->scheduled = false;
+        k_work_submit_to_queue(&display_queue, &timer->work);
+        run_queue();
+    }
+
+    now = MAX(now, until);
+}
+
+int64_t host_run_all(void) {
+    struct k_work_delayable *timer;
+
+    run_queue();
+    while ((timer = next_timer()) != NULL) {
+        host_run_until(timer->due);
+    }
+
+    return now;
+}
+
+int host_work_pending(void) {
+    int pending = 0;
+
+    for (struct k_work *work = queue_head; work != NULL; work = work->next) {
+        pending++;
+    }
+    for (struct k_work_delayable *timer = timers; timer != NULL; timer = timer->next_timer) {
+        pending += timer->scheduled;
+    }
+
+    return pending;
+}
+
+/**
+ * Logging
+ **/
+
+void host_log(const char *level, const char *fmt, ...) {
+    static int enabled = -1;
+    va_list args;
+
+    if (enabled < 0) {
+        const char *env = getenv("HOST_LOG");
+        enabled = env != NULL && strcmp(env, "1") == 0;
+    }
+
+    if (enabled) {
+        printf("[%6lld] <%s> ", (long long)now, level);
+        va_start(args, fmt);
+        vprintf(fmt, args);
+        va_end(args);
+        printf("\n");
+    }
+}
+
+/**
+ * Display
+ **/
+
+const struct device host_display_device = {.name = "host_display"};
+struct host_display host_display;
+
+void display_get_capabilities(const struct device *dev, struct display_capabilities *caps) {
+    *caps = (struct display_capabilities){
+        .x_resolution = HOST_PANEL_WIDTH,
+        .y_resolution = HOST_PANEL_LINES,
+        .supported_pixel_formats = PIXEL_FORMAT_MONO01,
+        .screen_info = SCREEN_INFO_X_ALIGNMENT_WIDTH,
+        .current_pixel_format = PIXEL_FORMAT_MONO01,
+    };
+}
+
+int display_write(const struct device *dev, uint16_t x, uint16_t y,
+                  const struct display_buffer_descriptor *desc, const void *buf) {
+    // Line-addressed: only whole lines can be written
+    if (x != 0 || desc->width != HOST_PANEL_WIDTH || y + desc->height > HOST_PANEL_LINES ||
+        desc->buf_size < desc->height * HOST_LINE_BYTES) {
+        return -EINVAL;
+    }
+
+    memcpy(host_display.lines[y], buf, desc->height * HOST_LINE_BYTES);
+    for (uint16_t line = y; line < y + desc->height; line++) {
+        host_display.written[line] = true;
+    }
+    host_display.writes++;
+    host_display.lines_written += desc->height;
+    host_display.bytes += desc->height * HOST_LINE_BYTES;
+
+    return 0;
+}
+
+void host_display_reset_counters(void) {
+    memset(host_display.written, 0, sizeof(host_display.written));
+    host_display.writes = 0;
+    host_display.lines_written = 0;
+    host_display.bytes = 0;
+}
+
+bool host_panel_pixel(uint16_t x, uint16_t y) {
+    return host_display.lines[y][x / 8] & BIT(x % 8);
+}
+
+void lv_refr_now(void *disp) {}
+
+/**
+ * Fonts
+ **/
+
+// Glyph index of a letter in a font with FORMAT0_TINY character maps, which is all fonts here
+static uint32_t glyph_id(const lv_font_fmt_txt_dsc_t *fdsc, uint32_t letter) {
+    for (uint16_t i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &fdsc->cmaps[i];
+        uint32_t offset = letter - cmap->range_start;
+
+        __ASSERT(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY, "Unsupported character map");
+        if (letter >= cmap->range_start && offset < cmap->range_length) {
+            return cmap->glyph_id_start + offset;
+        }
+    }
+
+    return 0;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                   uint32_t letter, uint32_t letter_next) {
+    const lv_font_fmt_txt_dsc_t *fdsc = font->dsc;
+    uint32_t gid = glyph_id(fdsc, letter);
+
+    if (gid == 0) {
+        return false;
+    }
+
+    const lv_font_fmt_txt_glyph_dsc_t *gdsc = &fdsc->glyph_dsc[gid];
+    // Advances are stored in 1/16 pixels and rounded, as without kerning in LVGL
+    *dsc_out = (lv_font_glyph_dsc_t){
+        .adv_w = (gdsc->adv_w + (1 << 3)) >> 4,
+        .box_w = gdsc->box_w,
+        .box_h = gdsc->box_h,
+        .ofs_x = gdsc->ofs_x,
+        .ofs_y = gdsc->ofs_y,
+        .bpp = fdsc->bpp,
+    };
+
+    return true;
+}
+
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter) {
+    const lv_font_fmt_txt_dsc_t *fdsc = font->dsc;
+    uint32_t gid = glyph_id(fdsc, letter);
+
+    return gid == 0 ? NULL : &fdsc->glyph_bitmap[fdsc->glyph_dsc[gid].bitmap_index];
+}
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                           uint32_t letter_next) {
+    return font->get_glyph_dsc(font, dsc_out, letter, letter_next);
+}
+
+const uint8_t *lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter) {
+    return font->get_glyph_bitmap(font, letter);
+}
+
+uint16_t lv_font_get_glyph_width(const lv_font_t *font, uint32_t letter, uint32_t letter_next) {
+    lv_font_glyph_dsc_t dsc;
+
+    return lv_font_get_glyph_dsc(font, &dsc, letter, letter_next) ? dsc.adv_w : 0;
+}
+
+/**
+ * Settings
+ **/
+
+#define SETTINGS_MAX 8
+#define SETTINGS_VALUE_MAX 16
+
+static const struct settings_handler_static *handlers[SETTINGS_MAX];
+static struct {
+    char name[48];
+    uint8_t value[SETTINGS_VALUE_MAX];
+    size_t len;
+} saved[SETTINGS_MAX];
+
+void host_settings_register(const struct settings_handler_static *handler) {
+    for (int i = 0; i < SETTINGS_MAX; i++) {
+        if (handlers[i] == NULL) {
+            handlers[i] = handler;
+            return;
+        }
+    }
+}
+
+int settings_name_steq(const char *name, const char *key, const char **next) {
+    size_t len = strlen(key);
+
+    if (strncmp(name, key, len) != 0 ||
+        (name[len] != '\0' && name[len] != '=' && name[len] != '/')) {
+        return 0;
+    }
+    if (next != NULL) {
+        *next = name[len] == '/' ? &name[len + 1] : NULL;
+    }
+
+    return 1;
+}
+
+struct setting_value {
+    const void *value;
+    size_t len;
+};
+
+static ssize_t read_value(void *cb_arg, void *data, size_t len) {
+    const struct setting_value *setting = cb_arg;
+
+    len = MIN(len, setting->len);
+    memcpy(data, setting->value, len);
+    return len;
+}
+
+int host_settings_set(const char *name, const void *value, size_t len) {
+    struct setting_value setting = {.value = value, .len = len};
+
+    for (int i = 0; i < SETTINGS_MAX && handlers[i] != NULL; i++) {
+        size_t tree = strlen(handlers[i]->name);
+
+        if (strncmp(name, handlers[i]->name, tree) == 0 && name[tree] == '/') {
+            return handlers[i]->h_set(name + tree + 1, len, read_value, &setting);
+        }
+    }
+
+    return -ENOENT;
+}
+
+int settings_save_one(const char *name, const void *value, size_t val_len) {
+    for (int i = 0; i < SETTINGS_MAX; i++) {
+        if (saved[i].name[0] == '\0' || strcmp(saved[i].name, name) == 0) {
+            if (val_len > SETTINGS_VALUE_MAX || strlen(name) >= sizeof(saved[i].name)) {
+                return -EINVAL;
+            }
+            strcpy(saved[i].name, name);
+            memcpy(saved[i].value, value, val_len);
+            saved[i].len = val_len;
+            return 0;
+        }
+    }
+
+    return -ENOMEM;
+}
+
+const void *host_settings_saved(const char *name, size_t *len) {
+    for (int i = 0; i < SETTINGS_MAX; i++) {
+        if (strcmp(saved[i].name, name) == 0) {
+            *len = saved[i].len;
+            return saved[i].value;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * ZMK
+ **/
+
+bool host_display_initialized;
+
+struct k_work_q *zmk_display_work_q(void) { return &display_queue; }
+
+bool zmk_display_is_initialized(void) { return host_display_initialized; }
+
+struct host_keyboard host_keyboard = {
+    .layer_names = {NULL, "NAV", "SYMBOLS"},
+    .battery = 100,
+    .endpoint = {.transport = ZMK_TRANSPORT_BLE},
+    .profile_connected = true,
+};
+
+uint8_t zmk_keymap_highest_layer_active(void) { return host_keyboard.layer; }
+
+const char *zmk_keymap_layer_name(uint8_t layer) {
+    return layer < ZMK_KEYMAP_LAYERS_LEN ? host_keyboard.layer_names[layer] : NULL;
+}
+
+uint8_t zmk_battery_state_of_charge(void) { return host_keyboard.battery; }
+
+bool zmk_usb_is_powered(void) { return host_keyboard.usb_powered; }
+
+struct zmk_endpoint_instance zmk_endpoints_selected(void) { return host_keyboard.endpoint; }
+
+int zmk_ble_active_profile_index(void) { return host_keyboard.profile; }
+
+bool zmk_ble_active_profile_is_connected(void) { return host_keyboard.profile_connected; }
+
+bool zmk_ble_active_profile_is_open(void) { return host_keyboard.profile_open; }
+
+int zmk_wpm_get_state(void) { return host_keyboard.wpm; }
+
+enum zmk_activity_state zmk_activity_get_state(void) { return host_keyboard.activity; }
+
+/**
+ * Events
+ **/
+
+#define SUBSCRIPTIONS_MAX 16
+
+static struct {
+    const struct zmk_event_type *event;
+    const struct zmk_listener *listener;
+} subscriptions[SUBSCRIPTIONS_MAX];
+
+void zmk_event_manager_subscribe(const struct zmk_event_type *event,
+                                 const struct zmk_listener *listener) {
+    for (int i = 0; i < SUBSCRIPTIONS_MAX; i++) {
+        if (subscriptions[i].event == NULL) {
+            subscriptions[i].event = event;
+            subscriptions[i].listener = listener;
+            return;
+        }
+    }
+
+    __ASSERT(false, "Too many subscriptions");
+}
+
+int zmk_event_manager_raise(zmk_event_t *event) {
+    for (int i = 0; i < SUBSCRIPTIONS_MAX && subscriptions[i].event != NULL; i++) {
+        if (subscriptions[i].event == event->event) {
+            int ret = subscriptions[i].listener->callback(event);
+
+            if (ret != ZMK_EV_EVENT_BUBBLE) {
+                return ret;
+            }
+        }
+    }
+
+    return 0;
+}
+
+ZMK_EVENT_IMPL(zmk_activity_state_changed);
+ZMK_EVENT_IMPL(zmk_battery_state_changed);
+ZMK_EVENT_IMPL(zmk_ble_active_profile_changed);
+ZMK_EVENT_IMPL(zmk_endpoint_changed);
+ZMK_EVENT_IMPL(zmk_layer_state_changed);
+ZMK_EVENT_IMPL(zmk_usb_conn_state_changed);
+ZMK_EVENT_IMPL(zmk_wpm_state_changed);
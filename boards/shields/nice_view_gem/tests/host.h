@@ -0,0 +1,74 @@
+#pragma once
+
+// Test side of the stand-ins in stubs/: the virtual clock and work queue, the panel written by
+// display_write(), settings, and the keyboard state the ZMK functions report
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zmk/activity.h>
+#include <zmk/endpoints.h>
+#include <zmk/keymap.h>
+
+// The drawing backend the host builds run, which labels what the benchmarks and replays measure.
+// The LVGL stand-in has no renderer, so the default backend, canvas_lvgl.c drawing through
+// lv_canvas_draw_*() and LVGL's refresh, is neither built nor measured here.
+#define HOST_BACKEND "direct"
+BUILD_ASSERT(IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER),
+             "The host builds only have the direct framebuffer backend");
+
+#define HOST_PANEL_WIDTH 160
+#define HOST_PANEL_LINES 68
+#define HOST_LINE_BYTES (HOST_PANEL_WIDTH / 8)
+
+// The panel as a sharp,ls0xx driver reports it: MONO01, least significant bit first
+struct host_display {
+    uint8_t lines[HOST_PANEL_LINES][HOST_LINE_BYTES];
+    // Lines written since the counters were last reset
+    bool written[HOST_PANEL_LINES];
+    uint32_t writes;
+    uint32_t lines_written;
+    uint32_t bytes;
+};
+
+extern struct host_display host_display;
+
+void host_display_reset_counters(void);
+bool host_panel_pixel(uint16_t x, uint16_t y);
+
+// Runs queued work, and delayed work as its time comes, advancing the clock up to until
+void host_run_until(int64_t until);
+// Runs work until none is queued or scheduled, and returns the time the last item ran at
+int64_t host_run_all(void);
+// Number of work items queued or scheduled
+int host_work_pending(void);
+
+// CPU time of the calling thread in nanoseconds
+int64_t host_cpu_ns(void);
+// CPU time spent in work handlers so far, and when the one running now started
+extern int64_t host_work_cpu_ns;
+extern int64_t host_work_started_ns;
+
+// Passes a value to the settings handler of its subtree as if it had just been loaded
+int host_settings_set(const char *name, const void *value, size_t len);
+// Last value settings_save_one() stored under name, or NULL
+const void *host_settings_saved(const char *name, size_t *len);
+
+extern bool host_display_initialized;
+
+// What the ZMK functions report
+struct host_keyboard {
+    uint8_t layer;
+    // NULL for layers without a display name
+    const char *layer_names[ZMK_KEYMAP_LAYERS_LEN];
+    uint8_t battery;
+    bool usb_powered;
+    struct zmk_endpoint_instance endpoint;
+    uint8_t profile;
+    bool profile_connected;
+    bool profile_open;
+    int wpm;
+    enum zmk_activity_state activity;
+};
+
+extern struct host_keyboard host_keyboard;
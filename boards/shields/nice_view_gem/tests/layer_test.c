@@ -0,0 +1,116 @@
+/*
+ * Checks the layer name cache: at both orientations, blitting a cached layer name over the bottom
+ * region of any other layer must leave the region buffer exactly as a full render of that layer
+ * would. Layers past CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE, which the Makefile sets below the
+ * layer count, and renamed layers must not blit, and a full render must cache the new name.
+ */
+
+#include <zephyr/kernel.h>
+#include "canvas.h"
+#include "framebuffer.h"
+#include "host.h"
+#include "layer.h"
+#include "profile.h"
+#include "util.h"
+
+BUILD_ASSERT(CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE < ZMK_KEYMAP_LAYERS_LEN,
+             "Every layer is cached, so the bound is not tested");
+
+static canvas_t *scratch;
+static region_t *region;
+static uint8_t cbuf[CANVAS_BUF_SIZE(REGION_BOTTOM_HEIGHT)];
+static uint8_t expected[sizeof(cbuf)];
+static uint8_t bgbuf[BACKGROUND_BUF_SIZE(REGION_BOTTOM_HEIGHT)];
+static int failures;
+
+static struct status_state layer_state(uint8_t index) {
+    return (struct status_state){
+        .active_profile_index = 1,
+        .layer_index = index,
+        .layer_label = host_keyboard.layer_names[index],
+    };
+}
+
+// The bottom region steps of draw_bottom() in screen.c
+static void render(const struct status_state *state) {
+    resize_scratch(scratch, REGION_BOTTOM_HEIGHT);
+    load_background(scratch, bgbuf);
+    draw_profile_status(scratch, state);
+    draw_layer_status(scratch, state);
+    rotate_canvas(scratch, region, cbuf);
+}
+
+static void fail(const char *what, uint8_t from, uint8_t to) {
+    printf("%s at %d degrees, layer %u to %u\n", what, display_orientation(), from, to);
+    failures++;
+}
+
+static void test_blit(uint8_t from, uint8_t to) {
+    struct status_state before = layer_state(from);
+    struct status_state after = layer_state(to);
+
+    render(&after);
+    memcpy(expected, cbuf, sizeof(cbuf));
+
+    render(&before);
+    int rows = blit_layer_status(region, cbuf, &after);
+
+    if (to >= CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE) {
+        if (rows != -ENOENT) {
+            fail("Uncached layer blitted", from, to);
+        }
+    } else if (rows < 0) {
+        fail("Cached layer not blitted", from, to);
+    } else if (memcmp(cbuf, expected, sizeof(cbuf)) != 0) {
+        fail("Blit differs from render", from, to);
+    }
+}
+
+static void test_rename(void) {
+    const char *label = host_keyboard.layer_names[1];
+    struct status_state renamed = layer_state(1);
+
+    renamed.layer_label = "RENAMED";
+    if (blit_layer_status(region, cbuf, &renamed) != -ENOENT) {
+        fail("Renamed layer blitted", 1, 1);
+    }
+
+    host_keyboard.layer_names[1] = renamed.layer_label;
+    test_blit(0, 1);
+    host_keyboard.layer_names[1] = label;
+}
+
+static void test_orientation(enum orientation angle) {
+    uint16_t value = angle;
+
+    host_settings_set("nice_view_gem/orientation", &value, sizeof(value));
+    orientation_update();
+    place_region(region, cbuf, REGION_BOTTOM_OFFSET, REGION_BOTTOM_ALIGN_Y);
+    init_layer_names(scratch, bgbuf);
+
+    for (uint8_t from = 0; from < ZMK_KEYMAP_LAYERS_LEN; from++) {
+        for (uint8_t to = 0; to < ZMK_KEYMAP_LAYERS_LEN; to++) {
+            test_blit(from, to);
+        }
+    }
+    test_rename();
+}
+
+int main(void) {
+    framebuffer_init();
+    orientation_init(NULL);
+    region = create_region(NULL, cbuf, REGION_BOTTOM_HEIGHT);
+    scratch = create_scratch_canvas(NULL);
+
+    resize_scratch(scratch, REGION_BOTTOM_HEIGHT);
+    fill_background(scratch);
+    draw_profile_background(scratch);
+    save_background(scratch, bgbuf);
+
+    test_orientation(ORIENTATION_270);
+    test_orientation(ORIENTATION_90);
+
+    printf("layer: %d of %d names cached, %s\n", CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE,
+           ZMK_KEYMAP_LAYERS_LEN, failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,221 @@
+/*
+ * Checks that the direct framebuffer backend writes exactly the panel lines a render changes.
+ * Random pixels in a few scratch columns of each region are changed and rendered through
+ * rotate_canvas() and framebuffer_flush(), at both orientations. The changed columns become
+ * region buffer rows, and display_write() must receive just the panel lines those rows cover.
+ * blit_columns() is checked the same way, and after every flush the whole panel must match the
+ * region buffers.
+ */
+
+#include <zephyr/kernel.h>
+#include "canvas.h"
+#include "framebuffer.h"
+#include "host.h"
+#include "reference.h"
+#include "util.h"
+
+#define ROUNDS 200
+
+struct region {
+    const char *name;
+    uint16_t height;
+    int16_t offset;
+    int16_t align_y;
+    region_t *region;
+    uint8_t cbuf[CANVAS_BUF_SIZE(SCRATCH_HEIGHT)];
+    uint8_t image[PACKED_SIZE(SCREEN_WIDTH, SCRATCH_HEIGHT)];
+};
+
+static struct region regions[] = {
+    {"top", REGION_TOP_HEIGHT, REGION_TOP_OFFSET, REGION_TOP_ALIGN_Y},
+    {"middle", REGION_MIDDLE_HEIGHT, REGION_MIDDLE_OFFSET, REGION_MIDDLE_ALIGN_Y},
+    {"bottom", REGION_BOTTOM_HEIGHT, REGION_BOTTOM_OFFSET, REGION_BOTTOM_ALIGN_Y},
+};
+
+static canvas_t *scratch;
+static int failures;
+
+static void fail(const char *what, const struct region *r, int round, uint16_t line) {
+    printf("%s at %d degrees, %s region, round %d: line %u\n", what, display_orientation(),
+           r != NULL ? r->name : "no", round, line);
+    failures++;
+}
+
+// Every panel pixel a region covers must show its region buffer, set bits white
+static void check_panel(int round) {
+    for (size_t i = 0; i < ARRAY_SIZE(regions); i++) {
+        const struct region *r = &regions[i];
+
+        for (uint16_t row = 0; row < SCREEN_WIDTH; row++) {
+            int16_t line = r->region->y + row;
+
+            for (uint16_t col = 0; col < r->height && line >= 0 && line < PANEL_LINES; col++) {
+                if (host_panel_pixel(r->region->x + col, line) !=
+                    ref_get(r->cbuf, PACKED_STRIDE(r->height), col, row)) {
+                    fail("Panel differs from region buffer", r, round, line);
+                    return;
+                }
+            }
+        }
+    }
+}
+
+// Flushes and compares the lines written with those of the changed region buffer rows
+static void check_flush(const struct region *r, int round, const bool changed_rows[]) {
+    host_display_reset_counters();
+    framebuffer_flush();
+
+    for (uint16_t line = 0; line < PANEL_LINES; line++) {
+        int16_t row = line - r->region->y;
+        bool expected = row >= 0 && row < SCREEN_WIDTH && changed_rows[row];
+
+        if (host_display.written[line] != expected) {
+            fail(expected ? "Changed line not written" : "Unchanged line written", r, round, line);
+            break;
+        }
+    }
+
+    if (host_display.bytes != host_display.lines_written * HOST_LINE_BYTES) {
+        fail("Partial line written", r, round, 0);
+    }
+
+    check_panel(round);
+
+    host_display_reset_counters();
+    framebuffer_flush();
+    if (host_display.writes != 0) {
+        fail("Second flush wrote", r, round, 0);
+    }
+}
+
+// Region buffer row that a scratch column is rotated to
+static uint16_t column_row(uint16_t x) {
+    return display_orientation() == ORIENTATION_270 ? SCREEN_WIDTH - 1 - x : x;
+}
+
+static void render(struct region *r) {
+    resize_scratch(scratch, r->height);
+    canvas_unpack_rows(scratch, 0, r->height, r->image);
+    rotate_canvas(scratch, r->region, r->cbuf);
+}
+
+static void test_render(struct region *r, int round) {
+    bool changed_rows[SCREEN_WIDTH] = {false};
+    uint16_t x0 = rand() % SCREEN_WIDTH;
+    uint16_t w = 1 + rand() % MIN(8, SCREEN_WIDTH - x0);
+    uint16_t changed = 0;
+
+    uint8_t before[sizeof(r->image)];
+
+    // Some rounds change nothing, which must write nothing
+    memcpy(before, r->image, sizeof(before));
+    for (int flips = rand() % 6; flips > 0; flips--) {
+        ref_set(r->image, PACKED_STRIDE(SCREEN_WIDTH), x0 + rand() % w, rand() % r->height,
+                rand() % 2);
+    }
+
+    for (uint16_t x = x0; x < x0 + w; x++) {
+        for (uint16_t y = 0; y < r->height; y++) {
+            if (ref_get(before, PACKED_STRIDE(SCREEN_WIDTH), x, y) !=
+                ref_get(r->image, PACKED_STRIDE(SCREEN_WIDTH), x, y)) {
+                changed_rows[column_row(x)] = true;
+                changed++;
+                break;
+            }
+        }
+    }
+
+    resize_scratch(scratch, r->height);
+    canvas_unpack_rows(scratch, 0, r->height, r->image);
+    if (rotate_canvas(scratch, r->region, r->cbuf) != changed) {
+        fail("Wrong changed line count", r, round, changed);
+    }
+
+    check_flush(r, round, changed_rows);
+}
+
+static void test_blit(struct region *r, int round) {
+    bool changed_rows[SCREEN_WIDTH] = {false};
+    uint16_t stride = PACKED_STRIDE(r->height);
+    uint16_t x = rand() % r->height;
+    uint16_t w = 1 + rand() % (r->height - x);
+    uint16_t bytes = PACKED_STRIDE(x + w) - x / 8;
+    uint8_t src[SCREEN_WIDTH * PACKED_STRIDE(SCRATCH_HEIGHT)];
+    uint8_t expected[sizeof(r->cbuf)];
+
+    // A few rows get new pixels, the rest keep theirs
+    memcpy(expected, r->cbuf, sizeof(expected));
+    for (uint16_t row = 0; row < SCREEN_WIDTH; row++) {
+        bool change = rand() % 4 == 0;
+
+        for (uint16_t col = x; col < x + w; col++) {
+            bool on = ref_get(r->cbuf, stride, col, row);
+            on = change ? rand() % 2 : on;
+            changed_rows[row] |= on != ref_get(r->cbuf, stride, col, row);
+            ref_set(expected, stride, col, row, on);
+        }
+        memcpy(&src[row * bytes], &expected[row * stride + x / 8], bytes);
+    }
+
+    blit_columns(r->region, r->cbuf, src, x, w);
+    if (memcmp(expected, r->cbuf, sizeof(expected)) != 0) {
+        fail("Blit changed columns outside its span", r, round, 0);
+    }
+
+    check_flush(r, round, changed_rows);
+
+    // Back to the rotated image, which the next render is compared against
+    render(r);
+    framebuffer_flush();
+}
+
+static void test_orientation(enum orientation angle) {
+    uint16_t value = angle;
+
+    host_settings_set("nice_view_gem/orientation", &value, sizeof(value));
+    orientation_update();
+    framebuffer_clear();
+    for (size_t i = 0; i < ARRAY_SIZE(regions); i++) {
+        struct region *r = &regions[i];
+
+        place_region(r->region, r->cbuf, r->offset, r->align_y);
+        ref_fill_random(r->image, sizeof(r->image));
+        render(r);
+    }
+
+    // Clearing the framebuffer rewrites every line
+    host_display_reset_counters();
+    framebuffer_flush();
+    if (host_display.lines_written != PANEL_LINES) {
+        fail("Not every line written after clear", NULL, 0, host_display.lines_written);
+    }
+    check_panel(0);
+
+    for (int round = 0; round < ROUNDS; round++) {
+        struct region *r = &regions[rand() % ARRAY_SIZE(regions)];
+
+        if (round % 3 == 2) {
+            test_blit(r, round);
+        } else {
+            test_render(r, round);
+        }
+    }
+}
+
+int main(void) {
+    srand(1);
+
+    framebuffer_init();
+    orientation_init(NULL);
+    scratch = create_scratch_canvas(NULL);
+    for (size_t i = 0; i < ARRAY_SIZE(regions); i++) {
+        regions[i].region = create_region(NULL, regions[i].cbuf, regions[i].height);
+    }
+
+    test_orientation(ORIENTATION_270);
+    test_orientation(ORIENTATION_90);
+    test_orientation(ORIENTATION_270);
+
+    printf("lines: %zu regions, %s\n", ARRAY_SIZE(regions), failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
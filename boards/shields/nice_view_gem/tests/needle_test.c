@@ -0,0 +1,93 @@
+/*
+ * Checks the generated WPM needle table against the float needle the gauge drew before it: for
+ * every value 0-255 and every range maximum 1-255 the table must give the same end points, and
+ * at the configured fixed range the needle drawn from it must match the float needle pixel for
+ * pixel. wpm.c is included to reach its static lookup.
+ */
+
+#include <math.h>
+#include "../widgets/wpm.c"
+
+#define NEEDLE_ROWS (WPM_NEEDLE_Y + 1)
+
+static int failures;
+
+// The per-render float code of the gauge, with the range maximum as a float like it had
+static void float_needle(int value, float max, lv_point_t points[2]) {
+    if (value > max) {
+        value = max;
+    }
+    float angleDeg = 225 + ((float)value / max) * 90;
+    float angleRad = angleDeg * (3.14159f / 180.0f);
+    points[0].x = WPM_NEEDLE_X + (int)((float)WPM_NEEDLE_INNER * cosf(angleRad));
+    points[0].y = WPM_NEEDLE_Y + (int)((float)WPM_NEEDLE_INNER * sinf(angleRad));
+    points[1].x = WPM_NEEDLE_X + (int)(WPM_NEEDLE_OUTER * cosf(angleRad));
+    points[1].y = WPM_NEEDLE_Y + (int)(WPM_NEEDLE_OUTER * sinf(angleRad));
+}
+
+static void test_positions(void) {
+    for (int max = 1; max <= 255; max++) {
+        for (int value = 0; value <= 255; value++) {
+            const struct needle_position *needle = needle_for(value, max);
+            lv_point_t expected[2];
+
+            float_needle(value, max, expected);
+            if (WPM_NEEDLE_X + needle->start_x != expected[0].x ||
+                WPM_NEEDLE_Y + needle->start_y != expected[0].y ||
+                WPM_NEEDLE_X + needle->end_x != expected[1].x ||
+                WPM_NEEDLE_Y + needle->end_y != expected[1].y) {
+                printf("needle %d of %d: table (%d, %d)-(%d, %d), float (%d, %d)-(%d, %d)\n",
+                       value, max, WPM_NEEDLE_X + needle->start_x, WPM_NEEDLE_Y + needle->start_y,
+                       WPM_NEEDLE_X + needle->end_x, WPM_NEEDLE_Y + needle->end_y, expected[0].x,
+                       expected[0].y, expected[1].x, expected[1].y);
+                failures++;
+            }
+        }
+    }
+}
+
+static void draw_rows(canvas_t *canvas, uint8_t *rows, const struct status_state *state,
+                      const lv_point_t *points) {
+    canvas_fill_rect(canvas, 0, 0, SCREEN_WIDTH, NEEDLE_ROWS, lv_color_white());
+    if (state != NULL) {
+        draw_needle(canvas, state);
+    } else {
+        canvas_draw_line(canvas, points, 2, LVGL_FOREGROUND, 1);
+    }
+    canvas_pack_rows(canvas, 0, NEEDLE_ROWS, rows);
+}
+
+static void test_pixels(void) {
+    canvas_t *canvas = create_scratch_canvas(NULL);
+    uint8_t table[PACKED_SIZE(SCREEN_WIDTH, NEEDLE_ROWS)];
+    uint8_t expected[sizeof(table)];
+    struct status_state state;
+    int max = CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX ? CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX
+                                                        : 100;
+
+    resize_scratch(canvas, REGION_MIDDLE_HEIGHT);
+    wpm_history_init(&state.wpm);
+
+    for (int value = 0; value <= 255; value++) {
+        lv_point_t points[2];
+
+        wpm_history_push(&state.wpm, value);
+        float_needle(value, max, points);
+        draw_rows(canvas, table, &state, NULL);
+        draw_rows(canvas, expected, NULL, points);
+
+        if (memcmp(table, expected, sizeof(table)) != 0) {
+            printf("needle pixels differ at %d WPM\n", value);
+            failures++;
+        }
+    }
+}
+
+int main(void) {
+    test_positions();
+    test_pixels();
+
+    printf("needle: %u positions, %s\n", (unsigned)ARRAY_SIZE(needle_positions),
+           failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Checks where each orientation puts the screen on the panel. A known pattern is rendered into
+ * every region and each panel pixel must show the layout pixel that the angle maps onto it:
+ *
+ *     270 degrees: layout (x, y) at panel (y, SCREEN_WIDTH - 1 - x)
+ *      90 degrees: layout (x, y) at panel (SCREEN_HEIGHT - 1 - y, x)
+ *
+ * with y counted down the whole layout and each region's REGION_*_ALIGN_Y shift. The full panel
+ * at 90 degrees must then be the one at 270 degrees turned 180 degrees. The settings handler must
+ * reject the unsupported angles 0 and 180 and keep the current one.
+ */
+
+#include <zephyr/kernel.h>
+#include "canvas.h"
+#include "framebuffer.h"
+#include "host.h"
+#include "reference.h"
+
+struct region {
+    const char *name;
+    uint16_t height;
+    int16_t offset;
+    int16_t align_y;
+    region_t *region;
+    uint8_t cbuf[CANVAS_BUF_SIZE(SCRATCH_HEIGHT)];
+    uint8_t image[PACKED_SIZE(SCREEN_WIDTH, SCRATCH_HEIGHT)];
+};
+
+static struct region regions[] = {
+    {"top", REGION_TOP_HEIGHT, REGION_TOP_OFFSET, REGION_TOP_ALIGN_Y},
+    {"middle", REGION_MIDDLE_HEIGHT, REGION_MIDDLE_OFFSET, REGION_MIDDLE_ALIGN_Y},
+    {"bottom", REGION_BOTTOM_HEIGHT, REGION_BOTTOM_OFFSET, REGION_BOTTOM_ALIGN_Y},
+};
+
+static canvas_t *scratch;
+static struct host_display panel_270;
+static int failures;
+
+// A filled corner block, a diagonal and the left edge, so a mirrored or turned image differs
+static bool pattern(uint16_t x, uint16_t y) { return (x < 8 && y < 4) || x == y || x == 0; }
+
+static void set_orientation(uint16_t angle) {
+    host_settings_set("nice_view_gem/orientation", &angle, sizeof(angle));
+    orientation_update();
+}
+
+static void render(enum orientation angle) {
+    set_orientation(angle);
+    framebuffer_clear();
+
+    for (size_t i = 0; i < ARRAY_SIZE(regions); i++) {
+        struct region *r = &regions[i];
+
+        place_region(r->region, r->cbuf, r->offset, r->align_y);
+        resize_scratch(scratch, r->height);
+        canvas_unpack_rows(scratch, 0, r->height, r->image);
+        rotate_canvas(scratch, r->region, r->cbuf);
+    }
+
+    framebuffer_flush();
+}
+
+static void panel_position(const struct region *r, uint16_t x, uint16_t y, int16_t *px,
+                           int16_t *line) {
+    if (display_orientation() == ORIENTATION_90) {
+        *px = SCREEN_HEIGHT - 1 - (r->offset + y);
+        *line = x - r->align_y;
+    } else {
+        *px = r->offset + y;
+        *line = SCREEN_WIDTH - 1 - x + r->align_y;
+    }
+}
+
+static void check_pattern(void) {
+    for (size_t i = 0; i < ARRAY_SIZE(regions); i++) {
+        const struct region *r = &regions[i];
+
+        for (uint16_t y = 0; y < r->height; y++) {
+            for (uint16_t x = 0; x < SCREEN_WIDTH; x++) {
+                int16_t px, line;
+
+                panel_position(r, x, y, &px, &line);
+                if (line < 0 || line >= PANEL_LINES) {
+                    continue;
+                }
+                if (host_panel_pixel(px, line) != pattern(x, y)) {
+                    printf("%s region pixel (%u, %u) wrong at panel (%d, %d), %d degrees\n",
+                           r->name, x, y, px, line, display_orientation());
+                    failures++;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+static void check_turned(void) {
+    for (uint16_t line = 0; line < PANEL_LINES; line++) {
+        for (uint16_t px = 0; px < HOST_PANEL_WIDTH; px++) {
+            uint16_t turned_px = HOST_PANEL_WIDTH - 1 - px;
+            uint16_t turned_line = PANEL_LINES - 1 - line;
+            bool turned = panel_270.lines[turned_line][turned_px / 8] & (1 << (turned_px % 8));
+
+            if (host_panel_pixel(px, line) != turned) {
+                printf("Panel at 90 degrees is not the one at 270 turned, at (%u, %u)\n", px,
+                       line);
+                failures++;
+                return;
+            }
+        }
+    }
+}
+
+static void test_unsupported(uint16_t angle) {
+    enum orientation before = display_orientation();
+    uint16_t value = angle;
+
+    if (host_settings_set("nice_view_gem/orientation", &value, sizeof(value)) != -EINVAL) {
+        printf("Unsupported orientation %u accepted\n", angle);
+        failures++;
+    }
+    if (orientation_update() || display_orientation() != before) {
+        printf("Unsupported orientation %u changed the orientation\n", angle);
+        failures++;
+    }
+}
+
+int main(void) {
+    framebuffer_init();
+    orientation_init(NULL);
+    scratch = create_scratch_canvas(NULL);
+
+    for (size_t i = 0; i < ARRAY_SIZE(regions); i++) {
+        struct region *r = &regions[i];
+
+        r->region = create_region(NULL, r->cbuf, r->height);
+        for (uint16_t y = 0; y < r->height; y++) {
+            for (uint16_t x = 0; x < SCREEN_WIDTH; x++) {
+                ref_set(r->image, PACKED_STRIDE(SCREEN_WIDTH), x, y, pattern(x, y));
+            }
+        }
+    }
+
+    render(ORIENTATION_270);
+    check_pattern();
+    panel_270 = host_display;
+
+    render(ORIENTATION_90);
+    check_pattern();
+    check_turned();
+
+    test_unsupported(0);
+    test_unsupported(180);
+
+    printf("orientation: 90 and 270 degrees, %s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
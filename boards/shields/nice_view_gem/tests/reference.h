@@ -0,0 +1,82 @@
+#pragma once
+
+// Per-pixel reference rotations of packed MSB-first 1bpp images, which the kernels in rotate.c
+// are checked and timed against. Padding bits of destination rows are written as 0, and damage
+// accumulates the XOR of old and new destination bytes, like the kernels do.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define REF_STRIDE(w) (((w) + 7) / 8)
+
+static inline bool ref_get(const uint8_t *buf, uint16_t stride, uint16_t x, uint16_t y) {
+    return buf[y * stride + x / 8] & (0x80 >> (x % 8));
+}
+
+static inline void ref_set(uint8_t *buf, uint16_t stride, uint16_t x, uint16_t y, bool on) {
+    uint8_t mask = 0x80 >> (x % 8);
+
+    if (on) {
+        buf[y * stride + x / 8] |= mask;
+    } else {
+        buf[y * stride + x / 8] &= ~mask;
+    }
+}
+
+// Source pixel that lands on destination (x, y) of a rotated w x h source
+typedef void (*ref_map_t)(uint16_t w, uint16_t h, uint16_t x, uint16_t y, uint16_t *sx,
+                          uint16_t *sy);
+
+// dst(x, y) = src(y, h - 1 - x)
+static void ref_map_90(uint16_t w, uint16_t h, uint16_t x, uint16_t y, uint16_t *sx,
+                       uint16_t *sy) {
+    *sx = y;
+    *sy = h - 1 - x;
+}
+
+// dst(x, y) = src(w - 1 - x, h - 1 - y)
+static void ref_map_180(uint16_t w, uint16_t h, uint16_t x, uint16_t y, uint16_t *sx,
+                        uint16_t *sy) {
+    *sx = w - 1 - x;
+    *sy = h - 1 - y;
+}
+
+// dst(x, y) = src(w - 1 - y, x)
+static void ref_map_270(uint16_t w, uint16_t h, uint16_t x, uint16_t y, uint16_t *sx,
+                        uint16_t *sy) {
+    *sx = w - 1 - y;
+    *sy = x;
+}
+
+// Rotates into a dst_w x dst_h image: h x w for 90 and 270 degrees, w x h for 180
+static void ref_rotate(ref_map_t map, const uint8_t *src, uint16_t src_stride, uint16_t w,
+                       uint16_t h, uint8_t *dst, uint16_t dst_stride, uint16_t dst_w,
+                       uint16_t dst_h, uint8_t *damage) {
+    uint8_t row[32];
+
+    for (uint16_t y = 0; y < dst_h; y++) {
+        uint8_t *out = dst + y * dst_stride;
+
+        memset(row, 0, sizeof(row));
+        for (uint16_t x = 0; x < dst_w; x++) {
+            uint16_t sx, sy;
+            map(w, h, x, y, &sx, &sy);
+            ref_set(row, 0, x, 0, ref_get(src, src_stride, sx, sy));
+        }
+
+        for (uint16_t i = 0; i < REF_STRIDE(dst_w); i++) {
+            if (damage != NULL) {
+                damage[y] |= out[i] ^ row[i];
+            }
+            out[i] = row[i];
+        }
+    }
+}
+
+static inline void ref_fill_random(uint8_t *buf, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        buf[i] = rand();
+    }
+}
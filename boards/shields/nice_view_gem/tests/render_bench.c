@@ -0,0 +1,276 @@
+/*
+ * Times each region render step of the status screen on the host, for representative states:
+ * the draw_*_status() functions, update_wpm_chart() and rotate_canvas(). Each function is timed
+ * the way a render calls it, on the drawing surface of its region with the region background
+ * loaded.
+ *
+ * Prints CSV, one line per function and state:
+ *
+ *     backend,function,state,ns_per_call,allocs_per_call,bytes_touched,lines_changed
+ *
+ * backend is always "direct": only the direct framebuffer backend is built on the host, so the
+ * times are of canvas_direct.c and not of canvas_lvgl.c, the default, see HOST_BACKEND.
+ * allocs_per_call counts malloc(), calloc() and realloc() calls made from the widget code.
+ * bytes_touched is the number of drawing surface bytes a draw writes, or region buffer bytes a
+ * rotation writes, found by running it once over 0x00 and once over 0xFF. lines_changed is the
+ * number of panel lines a rotation changes, and 0 for draws.
+ */
+
+#include <zephyr/kernel.h>
+#include "battery.h"
+#include "bench.h"
+#include "canvas.h"
+#include "digits.h"
+#include "framebuffer.h"
+#include "host.h"
+#include "layer.h"
+#include "output.h"
+#include "profile.h"
+#include "util.h"
+#include "wpm.h"
+
+#define REPEATS 2000
+
+/**
+ * Allocation counting, linked with --wrap for each function
+ **/
+
+static uint32_t allocations;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    allocations++;
+    return __real_realloc(ptr, size);
+}
+
+/**
+ * Screen
+ **/
+
+static canvas_t *scratch;
+static region_t *top_region, *middle_region, *bottom_region;
+static uint8_t cbuf[CANVAS_BUF_SIZE(REGION_TOP_HEIGHT)];
+static uint8_t cbuf2[CANVAS_BUF_SIZE(REGION_MIDDLE_HEIGHT)];
+static uint8_t cbuf3[CANVAS_BUF_SIZE(REGION_BOTTOM_HEIGHT)];
+static uint8_t bgbuf[BACKGROUND_BUF_SIZE(REGION_TOP_HEIGHT)];
+static uint8_t bgbuf2[BACKGROUND_BUF_SIZE(REGION_MIDDLE_HEIGHT)];
+static uint8_t bgbuf3[BACKGROUND_BUF_SIZE(REGION_BOTTOM_HEIGHT)];
+static struct wpm_chart chart;
+
+// Same steps as zmk_widget_screen_init()
+static void init_screen(void) {
+    framebuffer_init();
+    orientation_init(NULL);
+    top_region = create_region(NULL, cbuf, REGION_TOP_HEIGHT);
+    middle_region = create_region(NULL, cbuf2, REGION_MIDDLE_HEIGHT);
+    bottom_region = create_region(NULL, cbuf3, REGION_BOTTOM_HEIGHT);
+    place_region(top_region, cbuf, REGION_TOP_OFFSET, REGION_TOP_ALIGN_Y);
+    place_region(middle_region, cbuf2, REGION_MIDDLE_OFFSET, REGION_MIDDLE_ALIGN_Y);
+    place_region(bottom_region, cbuf3, REGION_BOTTOM_OFFSET, REGION_BOTTOM_ALIGN_Y);
+
+    scratch = create_scratch_canvas(NULL);
+    init_digit_sprites();
+
+    resize_scratch(scratch, REGION_TOP_HEIGHT);
+    fill_background(scratch);
+    draw_output_background(scratch);
+    draw_battery_background(scratch);
+    save_background(scratch, bgbuf);
+
+    resize_scratch(scratch, REGION_MIDDLE_HEIGHT);
+    fill_background(scratch);
+    draw_wpm_background(scratch);
+    save_background(scratch, bgbuf2);
+
+    resize_scratch(scratch, REGION_BOTTOM_HEIGHT);
+    fill_background(scratch);
+    draw_profile_background(scratch);
+    save_background(scratch, bgbuf3);
+
+    init_layer_names(scratch, bgbuf3);
+}
+
+/**
+ * Steps
+ **/
+
+static void run_output(void *state) { draw_output_status(scratch, state); }
+static void run_battery(void *state) { draw_battery_status(scratch, state); }
+static void run_wpm(void *state) { draw_wpm_status(scratch, &chart, state); }
+static void run_profile(void *state) { draw_profile_status(scratch, state); }
+static void run_layer(void *state) { draw_layer_status(scratch, state); }
+
+// Every call adds a sample, so the chart scrolls by one step like it does on each WPM tick
+static void run_wpm_chart(void *arg) {
+    struct status_state *state = arg;
+
+    wpm_history_push(&state->wpm, (wpm_history_latest(&state->wpm) + 37) % 100);
+    update_wpm_chart(scratch, &chart, state);
+}
+
+struct rotation {
+    region_t *region;
+    uint8_t *cbuf;
+    // Flip a pixel before each rotation, or rotate an unchanged surface
+    bool change;
+    uint16_t lines;
+};
+
+static void run_rotate(void *arg) {
+    struct rotation *rotation = arg;
+
+    if (rotation->change) {
+        scratch->buf[SCREEN_WIDTH / 2 / 8] ^= 0x80 >> (SCREEN_WIDTH / 2 % 8);
+    }
+    rotation->lines = rotate_canvas(scratch, rotation->region, rotation->cbuf);
+}
+
+/**
+ * Measurement
+ **/
+
+// Bytes of buf that fn writes: those that change over 0x00 or over 0xFF. Restores buf after.
+static uint32_t bytes_touched(uint8_t *buf, size_t size, void (*fn)(void *), void *arg) {
+    static uint8_t saved[PACKED_SIZE(SCREEN_WIDTH, SCRATCH_HEIGHT)];
+    static uint8_t over_zero[sizeof(saved)];
+    uint32_t count = 0;
+
+    memcpy(saved, buf, size);
+    memset(buf, 0x00, size);
+    fn(arg);
+    memcpy(over_zero, buf, size);
+    memset(buf, 0xFF, size);
+    fn(arg);
+
+    for (size_t i = 0; i < size; i++) {
+        count += over_zero[i] != 0x00 || buf[i] != 0xFF;
+    }
+    memcpy(buf, saved, size);
+
+    return count;
+}
+
+static void report(const char *function, const char *name, void (*fn)(void *), void *arg,
+                   uint32_t touched, uint16_t lines) {
+    uint32_t before = allocations;
+    double ns = bench_ns(fn, arg, REPEATS);
+    double allocs = (double)(allocations - before) / (BENCH_BATCHES * REPEATS);
+
+    printf("%s,%s,%s,%.0f,%.2f,%u,%u\n", HOST_BACKEND, function, name, ns, allocs, touched,
+           lines);
+}
+
+// Times a draw over the region background, as a render runs it
+static void measure_draw(const char *function, const char *name, uint16_t height,
+                         const uint8_t *background, void (*fn)(void *), void *state) {
+    resize_scratch(scratch, height);
+    uint32_t touched = bytes_touched(scratch->buf, PACKED_SIZE(SCREEN_WIDTH, height), fn, state);
+
+    load_background(scratch, background);
+    report(function, name, fn, state, touched, 0);
+}
+
+static void measure_rotate(const char *name, uint16_t height, const uint8_t *background,
+                           region_t *region, uint8_t *region_cbuf, bool change) {
+    struct rotation rotation = {.region = region, .cbuf = region_cbuf, .change = change};
+
+    resize_scratch(scratch, height);
+    load_background(scratch, background);
+    rotate_canvas(scratch, region, region_cbuf);
+
+    // Flips the pixel twice and restores the buffer, so the next rotation starts in sync
+    uint32_t touched = bytes_touched(region_cbuf, CANVAS_BUF_SIZE(height), run_rotate, &rotation);
+    run_rotate(&rotation);
+
+    report("rotate_canvas", name, run_rotate, &rotation, touched, rotation.lines);
+    framebuffer_flush();
+}
+
+static struct status_state wpm_state(const uint8_t samples[WPM_HISTORY]) {
+    struct status_state state = {0};
+
+    wpm_history_init(&state.wpm);
+    for (int i = 0; i < WPM_HISTORY; i++) {
+        wpm_history_push(&state.wpm, samples[i]);
+    }
+
+    return state;
+}
+
+int main(void) {
+    static const uint8_t idle[WPM_HISTORY] = {0};
+    static const uint8_t typing[WPM_HISTORY] = {12, 25, 38, 47, 55, 61, 58, 64, 70, 63};
+    static const uint8_t burst[WPM_HISTORY] = {0, 0, 35, 80, 120, 96, 40, 0, 0, 0};
+
+    init_screen();
+
+    printf("backend,function,state,ns_per_call,allocs_per_call,bytes_touched,lines_changed\n");
+
+    struct status_state usb = {.selected_endpoint = {.transport = ZMK_TRANSPORT_USB}};
+    struct status_state ble = {.selected_endpoint = {.transport = ZMK_TRANSPORT_BLE},
+                               .active_profile_bonded = true,
+                               .active_profile_connected = true};
+    struct status_state ble_searching = {.selected_endpoint = {.transport = ZMK_TRANSPORT_BLE},
+                                         .active_profile_bonded = true};
+    struct status_state ble_open = {.selected_endpoint = {.transport = ZMK_TRANSPORT_BLE}};
+    measure_draw("draw_output_status", "usb", REGION_TOP_HEIGHT, bgbuf, run_output, &usb);
+    measure_draw("draw_output_status", "ble", REGION_TOP_HEIGHT, bgbuf, run_output, &ble);
+    measure_draw("draw_output_status", "ble_searching", REGION_TOP_HEIGHT, bgbuf, run_output,
+                 &ble_searching);
+    measure_draw("draw_output_status", "ble_open", REGION_TOP_HEIGHT, bgbuf, run_output,
+                 &ble_open);
+
+    struct status_state full = {.battery = 100};
+    struct status_state half = {.battery = 57};
+    struct status_state charging = {.battery = 42, .charging = true};
+    measure_draw("draw_battery_status", "100", REGION_TOP_HEIGHT, bgbuf, run_battery, &full);
+    measure_draw("draw_battery_status", "57", REGION_TOP_HEIGHT, bgbuf, run_battery, &half);
+    measure_draw("draw_battery_status", "42_charging", REGION_TOP_HEIGHT, bgbuf, run_battery,
+                 &charging);
+
+    struct status_state wpm_idle = wpm_state(idle);
+    struct status_state wpm_typing = wpm_state(typing);
+    struct status_state wpm_burst = wpm_state(burst);
+    // Each state is drawn with its own chart, as it would be after the render that pushed it
+    resize_scratch(scratch, REGION_MIDDLE_HEIGHT);
+    update_wpm_chart(scratch, &chart, &wpm_idle);
+    measure_draw("draw_wpm_status", "idle", REGION_MIDDLE_HEIGHT, bgbuf2, run_wpm, &wpm_idle);
+    update_wpm_chart(scratch, &chart, &wpm_typing);
+    measure_draw("draw_wpm_status", "typing", REGION_MIDDLE_HEIGHT, bgbuf2, run_wpm, &wpm_typing);
+    update_wpm_chart(scratch, &chart, &wpm_burst);
+    measure_draw("draw_wpm_status", "burst", REGION_MIDDLE_HEIGHT, bgbuf2, run_wpm, &wpm_burst);
+    measure_draw("update_wpm_chart", "typing", REGION_MIDDLE_HEIGHT, bgbuf2, run_wpm_chart,
+                 &wpm_typing);
+
+    struct status_state first = {.active_profile_index = 0};
+    struct status_state last = {.active_profile_index = 4};
+    measure_draw("draw_profile_status", "0", REGION_BOTTOM_HEIGHT, bgbuf3, run_profile, &first);
+    measure_draw("draw_profile_status", "4", REGION_BOTTOM_HEIGHT, bgbuf3, run_profile, &last);
+
+    struct status_state base = {.layer_index = 0, .layer_label = NULL};
+    struct status_state symbols = {.layer_index = 2, .layer_label = "SYMBOLS"};
+    measure_draw("draw_layer_status", "unnamed", REGION_BOTTOM_HEIGHT, bgbuf3, run_layer, &base);
+    measure_draw("draw_layer_status", "named", REGION_BOTTOM_HEIGHT, bgbuf3, run_layer, &symbols);
+
+    measure_rotate("top", REGION_TOP_HEIGHT, bgbuf, top_region, cbuf, true);
+    measure_rotate("top_unchanged", REGION_TOP_HEIGHT, bgbuf, top_region, cbuf, false);
+    measure_rotate("middle", REGION_MIDDLE_HEIGHT, bgbuf2, middle_region, cbuf2, true);
+    measure_rotate("middle_unchanged", REGION_MIDDLE_HEIGHT, bgbuf2, middle_region, cbuf2, false);
+    measure_rotate("bottom", REGION_BOTTOM_HEIGHT, bgbuf3, bottom_region, cbuf3, true);
+    measure_rotate("bottom_unchanged", REGION_BOTTOM_HEIGHT, bgbuf3, bottom_region, cbuf3, false);
+
+    return 0;
+}
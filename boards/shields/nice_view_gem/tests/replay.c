@@ -0,0 +1,318 @@
+/*
+ * Replays a recorded session through the status screen: screen.c's listeners, state changes,
+ * frame scheduling and renders, down to the lines display_write() sends to the panel.
+ *
+ *     build/replay sessions/typing.log
+ *
+ * A session is a text file with one event per line, after its time in milliseconds:
+ *
+ *     <ms> wpm <value>
+ *     <ms> layer <highest active layer>
+ *     <ms> battery <percent>
+ *     <ms> usb <0|1>
+ *     <ms> endpoint <usb|ble>
+ *     <ms> profile <index> <connected|bonded|open>
+ *     <ms> activity <active|idle|sleep>
+ *
+ * Each event updates what the ZMK functions report and is raised at its time, with the display
+ * work queue run in between on the virtual clock. Events at time 0 are raised before the screen
+ * initializes, so they only set the state it boots with, as on the keyboard. Lines starting with
+ * # are comments.
+ *
+ * Lines of the form
+ *
+ *     expect <counter> [<=] <value>
+ *
+ * are checked against the counters below once the session has run, and the replay fails unless
+ * they all hold. Frames closer together than CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS also fail it.
+ *
+ * Prints CSV with one line for the session:
+ *
+ *     backend,session,events,frames,renders,skipped,cpu_us,frame_cpu_max_us,panel_writes,
+ *     spi_bytes,latency_max_ms,latency_mean_ms
+ *
+ * backend is always "direct". The screen runs on the direct framebuffer backend, which is off by
+ * default, so the counts and costs describe that configuration and not the LVGL canvas backend
+ * most builds use, see HOST_BACKEND.
+ * renders and skipped sum the region renders and the renders skipped because a region's state
+ * was unchanged. cpu_us is the host CPU time of all display work, and frame_cpu_max_us that of
+ * the slowest frame. spi_bytes is what the sharp,ls0xx driver clocks out for the lines written:
+ * a command and a trailing byte per write, and an address and a trailing byte around every line.
+ * Latency is the virtual time from an event to the end of the frame that renders it, which is
+ * what frame coalescing and idle holds add; rendering itself takes no virtual time. Events that
+ * are dropped, or held while idle, are timed from the frame they wake instead.
+ */
+
+#include <zephyr/kernel.h>
+#include <zmk/events/activity_state_changed.h>
+#include <zmk/events/battery_state_changed.h>
+#include <zmk/events/ble_active_profile_changed.h>
+#include <zmk/events/endpoint_changed.h>
+#include <zmk/events/layer_state_changed.h>
+#include <zmk/events/usb_conn_state_changed.h>
+#include <zmk/events/wpm_state_changed.h>
+#include "framebuffer.h"
+#include "host.h"
+#include "screen.h"
+
+#define LS0XX_WRITE_OVERHEAD 2
+#define LS0XX_LINE_OVERHEAD 2
+
+static struct zmk_widget_screen screen;
+
+/**
+ * Frames, counted by wrapping the flush at the end of render_frame()
+ **/
+
+static struct {
+    uint32_t events;
+    uint32_t frames;
+    int64_t frame_cpu_max_ns;
+    int64_t last_frame;
+    uint32_t interval_violations;
+    int64_t pending_since;
+    int64_t latency_max;
+    int64_t latency_total;
+    uint32_t latencies;
+} replay = {.last_frame = -1, .pending_since = -1};
+
+uint16_t __real_framebuffer_flush(void);
+
+uint16_t __wrap_framebuffer_flush(void) {
+    uint16_t lines = __real_framebuffer_flush();
+    int64_t now = k_uptime_get();
+
+    replay.frames++;
+    replay.frame_cpu_max_ns = MAX(replay.frame_cpu_max_ns, host_cpu_ns() - host_work_started_ns);
+
+    if (replay.last_frame >= 0 &&
+        now - replay.last_frame < CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS) {
+        printf("frames at %lld and %lld ms are closer than %d ms\n", (long long)replay.last_frame,
+               (long long)now, CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS);
+        replay.interval_violations++;
+    }
+    replay.last_frame = now;
+
+    if (replay.pending_since >= 0) {
+        int64_t latency = now - replay.pending_since;
+
+        replay.latency_max = MAX(replay.latency_max, latency);
+        replay.latency_total += latency;
+        replay.latencies++;
+        replay.pending_since = -1;
+    }
+
+    return lines;
+}
+
+/**
+ * Events
+ **/
+
+// Updates the keyboard state and raises the event for it, or returns false for an unknown event
+static bool raise_event(const char *event, const char *args) {
+    char word[16];
+    int value;
+
+    if (strcmp(event, "wpm") == 0 && sscanf(args, "%d", &value) == 1) {
+        host_keyboard.wpm = value;
+        raise_zmk_wpm_state_changed((struct zmk_wpm_state_changed){.state = value});
+    } else if (strcmp(event, "layer") == 0 && sscanf(args, "%d", &value) == 1 && value >= 0 &&
+               value < ZMK_KEYMAP_LAYERS_LEN) {
+        host_keyboard.layer = value;
+        raise_zmk_layer_state_changed(
+            (struct zmk_layer_state_changed){.layer = value, .state = true});
+    } else if (strcmp(event, "battery") == 0 && sscanf(args, "%d", &value) == 1) {
+        host_keyboard.battery = value;
+        raise_zmk_battery_state_changed(
+            (struct zmk_battery_state_changed){.state_of_charge = value});
+    } else if (strcmp(event, "usb") == 0 && sscanf(args, "%d", &value) == 1) {
+        host_keyboard.usb_powered = value;
+        raise_zmk_usb_conn_state_changed((struct zmk_usb_conn_state_changed){
+            .conn_state = value ? ZMK_USB_CONN_HID : ZMK_USB_CONN_NONE});
+    } else if (strcmp(event, "endpoint") == 0 && sscanf(args, "%15s", word) == 1 &&
+               (strcmp(word, "usb") == 0 || strcmp(word, "ble") == 0)) {
+        host_keyboard.endpoint.transport =
+            strcmp(word, "usb") == 0 ? ZMK_TRANSPORT_USB : ZMK_TRANSPORT_BLE;
+        host_keyboard.endpoint.ble.profile_index = host_keyboard.profile;
+        raise_zmk_endpoint_changed(
+            (struct zmk_endpoint_changed){.endpoint = host_keyboard.endpoint});
+    } else if (strcmp(event, "profile") == 0 && sscanf(args, "%d %15s", &value, word) == 2) {
+        host_keyboard.profile = value;
+        host_keyboard.profile_connected = strcmp(word, "connected") == 0;
+        host_keyboard.profile_open = strcmp(word, "open") == 0;
+        if (!host_keyboard.profile_connected && !host_keyboard.profile_open &&
+            strcmp(word, "bonded") != 0) {
+            return false;
+        }
+        host_keyboard.endpoint.ble.profile_index = value;
+        raise_zmk_ble_active_profile_changed(
+            (struct zmk_ble_active_profile_changed){.index = value});
+    } else if (strcmp(event, "activity") == 0 && sscanf(args, "%15s", word) == 1) {
+        if (strcmp(word, "active") == 0) {
+            host_keyboard.activity = ZMK_ACTIVITY_ACTIVE;
+        } else if (strcmp(word, "idle") == 0) {
+            host_keyboard.activity = ZMK_ACTIVITY_IDLE;
+        } else if (strcmp(word, "sleep") == 0) {
+            host_keyboard.activity = ZMK_ACTIVITY_SLEEP;
+        } else {
+            return false;
+        }
+        raise_zmk_activity_state_changed(
+            (struct zmk_activity_state_changed){.state = host_keyboard.activity});
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+static void replay_event(int64_t time, const char *event, const char *args, bool *ok) {
+    host_run_until(time);
+
+    if (replay.pending_since < 0) {
+        replay.pending_since = time;
+    }
+    if (!raise_event(event, args)) {
+        *ok = false;
+        return;
+    }
+    replay.events++;
+
+    // Run the listener work, and with it any frame that is due now. Without a frame scheduled
+    // after that, the event was dropped or is held, and is not timed from here.
+    host_run_until(time);
+    if (host_work_pending() == 0) {
+        replay.pending_since = -1;
+    }
+}
+
+/**
+ * Counters
+ **/
+
+struct counter {
+    const char *name;
+    int64_t value;
+};
+
+static int check(const char *expect, const struct counter *counters, size_t count) {
+    char name[32], op[3] = "==";
+    long long value;
+
+    if (sscanf(expect, "%31s <= %lld", name, &value) == 2) {
+        strcpy(op, "<=");
+    } else if (sscanf(expect, "%31s %lld", name, &value) != 2) {
+        printf("bad expectation: %s\n", expect);
+        return 1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(counters[i].name, name) != 0) {
+            continue;
+        }
+
+        bool holds = op[0] == '<' ? counters[i].value <= value : counters[i].value == value;
+        if (!holds) {
+            printf("expected %s %s %lld, got %lld\n", name, op, value,
+                   (long long)counters[i].value);
+        }
+        return !holds;
+    }
+
+    printf("unknown counter: %s\n", name);
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <session>\n", argv[0]);
+        return 2;
+    }
+
+    FILE *session = fopen(argv[1], "r");
+    if (session == NULL) {
+        perror(argv[1]);
+        return 2;
+    }
+
+    char line[128], expects[32][64];
+    int expect_count = 0, number = 0;
+    bool initialized = false;
+
+    while (fgets(line, sizeof(line), session) != NULL) {
+        char event[16], args[64] = "", *text = line + strspn(line, " \t");
+        long long time;
+        bool ok = true;
+
+        number++;
+        text[strcspn(text, "\r\n#")] = '\0';
+        if (text[0] == '\0') {
+            continue;
+        }
+
+        if (strncmp(text, "expect ", 7) == 0) {
+            if (expect_count < ARRAY_SIZE(expects)) {
+                snprintf(expects[expect_count++], sizeof(expects[0]), "%s", text + 7);
+            }
+            continue;
+        }
+
+        if (sscanf(text, "%lld %15s %63[^\n]", &time, event, args) < 2 ||
+            time < k_uptime_get()) {
+            ok = false;
+        } else {
+            if (time > 0 && !initialized) {
+                zmk_widget_screen_init(&screen, NULL);
+                host_display_initialized = true;
+                initialized = true;
+            }
+            replay_event(time, event, args, &ok);
+        }
+
+        if (!ok) {
+            fprintf(stderr, "%s:%d: bad event: %s\n", argv[1], number, text);
+            return 2;
+        }
+    }
+    fclose(session);
+
+    if (!initialized) {
+        zmk_widget_screen_init(&screen, NULL);
+        host_display_initialized = true;
+    }
+    host_run_all();
+
+    const struct counter counters[] = {
+        {"events", replay.events},
+        {"frames", replay.frames},
+        {"top_rendered", screen.top.rendered},
+        {"top_skipped", screen.top.skipped},
+        {"middle_rendered", screen.middle.rendered},
+        {"middle_skipped", screen.middle.skipped},
+        {"bottom_rendered", screen.bottom.rendered},
+        {"bottom_skipped", screen.bottom.skipped},
+        {"wpm_samples", screen.state.wpm.pushed},
+        {"panel_writes", host_display.writes},
+        {"panel_lines", host_display.lines_written},
+        {"latency_max_ms", replay.latency_max},
+    };
+    uint32_t renders = screen.top.rendered + screen.middle.rendered + screen.bottom.rendered;
+    uint32_t skipped = screen.top.skipped + screen.middle.skipped + screen.bottom.skipped;
+    uint32_t spi_bytes = host_display.writes * LS0XX_WRITE_OVERHEAD +
+                         host_display.lines_written * (HOST_LINE_BYTES + LS0XX_LINE_OVERHEAD);
+
+    printf("backend,session,events,frames,renders,skipped,cpu_us,frame_cpu_max_us,panel_writes,"
+           "spi_bytes,latency_max_ms,latency_mean_ms\n");
+    printf("%s,%s,%u,%u,%u,%u,%.1f,%.1f,%u,%u,%lld,%.1f\n", HOST_BACKEND, argv[1], replay.events,
+           replay.frames, renders, skipped, host_work_cpu_ns / 1e3, replay.frame_cpu_max_ns / 1e3,
+           host_display.writes, spi_bytes, (long long)replay.latency_max,
+           replay.latencies ? (double)replay.latency_total / replay.latencies : 0.0);
+
+    int failures = replay.interval_violations;
+    for (int i = 0; i < expect_count; i++) {
+        failures += check(expects[i], counters, ARRAY_SIZE(counters));
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Times the rotation kernels against the per-pixel reference rotations in reference.h, which is
+ * how regions were rotated before the kernels, for each region at both panel orientations.
+ */
+
+#include <stdio.h>
+#include <zephyr/kernel.h>
+#include "bench.h"
+#include "layout.h"
+#include "reference.h"
+#include "rotate.h"
+
+#define REPEATS 2000
+
+struct job {
+    bool kernel;
+    bool clockwise;
+    uint16_t h;
+    uint8_t src[PACKED_SIZE(SCREEN_WIDTH, SCRATCH_HEIGHT)];
+    uint8_t dst[PACKED_SIZE(SCRATCH_HEIGHT, SCREEN_WIDTH)];
+    uint8_t damage[SCREEN_WIDTH];
+};
+
+static void rotate(void *arg) {
+    struct job *job = arg;
+    uint16_t src_stride = PACKED_STRIDE(SCREEN_WIDTH);
+    uint16_t dst_stride = PACKED_STRIDE(job->h);
+
+    if (job->kernel && job->clockwise) {
+        rotate_1bpp_90(job->src, src_stride, SCREEN_WIDTH, job->h, job->dst, dst_stride,
+                       job->damage);
+    } else if (job->kernel) {
+        rotate_1bpp_270(job->src, src_stride, SCREEN_WIDTH, job->h, job->dst, dst_stride,
+                        job->damage);
+    } else {
+        ref_rotate(job->clockwise ? ref_map_90 : ref_map_270, job->src, src_stride, SCREEN_WIDTH,
+                   job->h, job->dst, dst_stride, job->h, SCREEN_WIDTH, job->damage);
+    }
+}
+
+int main(void) {
+    static const struct {
+        const char *name;
+        uint16_t h;
+    } regions[] = {
+        {"top", REGION_TOP_HEIGHT},
+        {"middle", REGION_MIDDLE_HEIGHT},
+        {"bottom", REGION_BOTTOM_HEIGHT},
+    };
+    static struct job job;
+
+    printf("%-8s %5s %6s %12s %12s %8s\n", "region", "angle", "size", "naive ns", "kernel ns",
+           "speedup");
+
+    for (size_t i = 0; i < ARRAY_SIZE(regions); i++) {
+        for (int clockwise = 1; clockwise >= 0; clockwise--) {
+            job.h = regions[i].h;
+            job.clockwise = clockwise;
+            ref_fill_random(job.src, sizeof(job.src));
+
+            job.kernel = false;
+            double naive = bench_ns(rotate, &job, REPEATS);
+            job.kernel = true;
+            double kernel = bench_ns(rotate, &job, REPEATS);
+
+            printf("%-8s %5d %3ux%-2u %12.0f %12.0f %7.1fx\n", regions[i].name,
+                   clockwise ? 90 : 270, SCREEN_WIDTH, job.h, naive, kernel, naive / kernel);
+        }
+    }
+
+    return 0;
+}
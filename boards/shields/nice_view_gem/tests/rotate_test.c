@@ -0,0 +1,152 @@
+/*
+ * Checks rotate_1bpp_90/180/270() bit for bit against per-pixel reference rotations, including
+ * the damage they report, for the region sizes and a spread of sizes that are not multiples of
+ * 8. Source padding bits are random and must not reach the destination. unpack_1bpp() and
+ * pack_1bpp() must round trip the same sizes.
+ */
+
+#include <stdio.h>
+#include <zephyr/kernel.h>
+#include "layout.h"
+#include "reference.h"
+#include "rotate.h"
+
+#define MAX_SIDE 160
+#define BUF_SIZE (PACKED_STRIDE(MAX_SIDE) * MAX_SIDE)
+#define ROUNDS 20
+
+static const uint16_t sizes[][2] = {
+    {SCREEN_WIDTH, REGION_TOP_HEIGHT},
+    {SCREEN_WIDTH, REGION_MIDDLE_HEIGHT},
+    {SCREEN_WIDTH, REGION_BOTTOM_HEIGHT},
+    {ANIMATION_WIDTH, ANIMATION_HEIGHT},
+    {SCREEN_HEIGHT, SCREEN_WIDTH},
+    {1, 1},
+    {8, 8},
+    {7, 9},
+    {13, 5},
+    {16, 24},
+    {33, 17},
+};
+
+static int failures;
+
+static void check(const char *kernel, uint16_t w, uint16_t h, int round, const uint8_t *expected,
+                  const uint8_t *actual, size_t size, const uint8_t *expected_damage,
+                  const uint8_t *actual_damage, uint16_t rows) {
+    for (size_t i = 0; i < size; i++) {
+        if (expected[i] != actual[i]) {
+            printf("%s %ux%u round %d: byte %zu is %02x, expected %02x\n", kernel, w, h, round, i,
+                   actual[i], expected[i]);
+            failures++;
+            return;
+        }
+    }
+
+    for (uint16_t y = 0; y < rows && expected_damage != NULL; y++) {
+        if (expected_damage[y] != actual_damage[y]) {
+            printf("%s %ux%u round %d: damage of row %u is %02x, expected %02x\n", kernel, w, h,
+                   round, y, actual_damage[y], expected_damage[y]);
+            failures++;
+            return;
+        }
+    }
+}
+
+static void test_size(uint16_t w, uint16_t h) {
+    static uint8_t src[BUF_SIZE], before[BUF_SIZE], expected[BUF_SIZE], actual[BUF_SIZE];
+    uint8_t expected_damage[MAX_SIDE], actual_damage[MAX_SIDE];
+    uint16_t src_stride = PACKED_STRIDE(w);
+    uint16_t turned_stride = PACKED_STRIDE(h);
+    size_t turned_size = turned_stride * w;
+
+    for (int round = 0; round < ROUNDS; round++) {
+        ref_fill_random(src, sizeof(src));
+        // Every other round starts from the previous output, so some rows see no change
+        if (round % 2 == 0) {
+            ref_fill_random(before, sizeof(before));
+        }
+
+        memcpy(expected, before, sizeof(before));
+        memcpy(actual, before, sizeof(before));
+        memset(expected_damage, 0, sizeof(expected_damage));
+        memset(actual_damage, 0, sizeof(actual_damage));
+        ref_rotate(ref_map_90, src, src_stride, w, h, expected, turned_stride, h, w,
+                   expected_damage);
+        rotate_1bpp_90(src, src_stride, w, h, actual, turned_stride, actual_damage);
+        check("rotate_1bpp_90", w, h, round, expected, actual, turned_size, expected_damage,
+              actual_damage, w);
+
+        memcpy(expected, before, sizeof(before));
+        memcpy(actual, before, sizeof(before));
+        memset(expected_damage, 0, sizeof(expected_damage));
+        memset(actual_damage, 0, sizeof(actual_damage));
+        ref_rotate(ref_map_270, src, src_stride, w, h, expected, turned_stride, h, w,
+                   expected_damage);
+        rotate_1bpp_270(src, src_stride, w, h, actual, turned_stride, actual_damage);
+        check("rotate_1bpp_270", w, h, round, expected, actual, turned_size, expected_damage,
+              actual_damage, w);
+
+        // Without damage the kernels must write the same pixels
+        memcpy(actual, before, sizeof(before));
+        rotate_1bpp_270(src, src_stride, w, h, actual, turned_stride, NULL);
+        check("rotate_1bpp_270 without damage", w, h, round, expected, actual, turned_size, NULL,
+              NULL, 0);
+
+        memcpy(expected, before, sizeof(before));
+        memcpy(actual, before, sizeof(before));
+        ref_rotate(ref_map_180, src, src_stride, w, h, expected, src_stride, w, h, NULL);
+        rotate_1bpp_180(src, src_stride, w, h, actual, src_stride);
+        check("rotate_1bpp_180", w, h, round, expected, actual, src_stride * h, NULL, NULL, 0);
+
+        if (round % 2 == 0) {
+            memcpy(before, actual, sizeof(before));
+        }
+    }
+}
+
+// Solid bytes take the fast path of unpack_1bpp(), so a third of them are solid
+static void test_unpack(uint16_t w, uint16_t h) {
+    static uint8_t packed[BUF_SIZE], repacked[BUF_SIZE];
+    static lv_color_t pixels[MAX_SIDE * MAX_SIDE];
+    uint16_t stride = PACKED_STRIDE(w);
+
+    for (size_t i = 0; i < stride * h; i++) {
+        int kind = rand() % 3;
+        packed[i] = kind == 0 ? 0x00 : kind == 1 ? 0xFF : rand();
+    }
+
+    unpack_1bpp(packed, stride, w, h, pixels);
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            if (lv_color_to1(pixels[y * w + x]) != ref_get(packed, stride, x, y)) {
+                printf("unpack_1bpp %ux%u: pixel %u,%u differs\n", w, h, x, y);
+                failures++;
+                return;
+            }
+        }
+    }
+
+    pack_1bpp(pixels, w, h, repacked, stride);
+    for (uint16_t y = 0; y < h; y++) {
+        for (uint16_t x = 0; x < w; x++) {
+            if (ref_get(repacked, stride, x, y) != ref_get(packed, stride, x, y)) {
+                printf("pack_1bpp %ux%u: pixel %u,%u differs\n", w, h, x, y);
+                failures++;
+                return;
+            }
+        }
+    }
+}
+
+int main(void) {
+    srand(1);
+
+    for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+        test_size(sizes[i][0], sizes[i][1]);
+        test_unpack(sizes[i][0], sizes[i][1]);
+    }
+
+    printf("rotate: %zu sizes, %s\n", ARRAY_SIZE(sizes), failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+// Kconfig of the host builds: the shield defaults on a central half, with the direct framebuffer
+// backend. Integer options can be overridden with -D.
+
+#define CONFIG_ZMK_DISPLAY 1
+#define CONFIG_NICE_VIEW_WIDGET_STATUS 1
+#define CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER 1
+#define CONFIG_NICE_VIEW_GEM_ORIENTATION_270 1
+#define CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE 1
+#define CONFIG_SETTINGS 1
+#define CONFIG_USB_DEVICE_STACK 1
+#define CONFIG_ZMK_BLE 1
+
+#ifndef CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX
+#define CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX 100
+#endif
+#ifndef CONFIG_NICE_VIEW_GEM_WPM_HISTORY
+#define CONFIG_NICE_VIEW_GEM_WPM_HISTORY 10
+#endif
+#ifndef CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS
+#define CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS 50
+#endif
+#ifndef CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE
+#define CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE 8
+#endif
+#define CONFIG_ZMK_LOG_LEVEL 0
@@ -0,0 +1,131 @@
+#pragma once
+
+// The parts of LVGL 8 the widgets and pixel_operator_mono use with LV_COLOR_DEPTH 1. Fonts are
+// read by the fmt_txt functions in host.c.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define LVGL_VERSION_MAJOR 8
+#define LVGL_VERSION_MINOR 3
+#define LVGL_VERSION_PATCH 0
+#define LV_VERSION_CHECK(x, y, z)                                                                  \
+    (x == LVGL_VERSION_MAJOR &&                                                                    \
+     (y < LVGL_VERSION_MINOR || (y == LVGL_VERSION_MINOR && z <= LVGL_VERSION_PATCH)))
+
+#define LV_ATTRIBUTE_LARGE_CONST
+
+typedef int16_t lv_coord_t;
+
+typedef union {
+    uint8_t full;
+} lv_color_t;
+
+static inline uint8_t lv_color_to1(lv_color_t color) { return color.full; }
+static inline lv_color_t lv_color_white(void) { return (lv_color_t){.full = 1}; }
+static inline lv_color_t lv_color_black(void) { return (lv_color_t){.full = 0}; }
+
+typedef struct {
+    lv_coord_t x;
+    lv_coord_t y;
+} lv_point_t;
+
+typedef struct _lv_obj_t lv_obj_t;
+
+enum {
+    LV_TEXT_ALIGN_AUTO,
+    LV_TEXT_ALIGN_LEFT,
+    LV_TEXT_ALIGN_CENTER,
+    LV_TEXT_ALIGN_RIGHT,
+};
+typedef uint8_t lv_text_align_t;
+
+void lv_refr_now(void *disp);
+
+/**
+ * Fonts
+ **/
+
+enum {
+    LV_FONT_SUBPX_NONE,
+};
+
+typedef struct {
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    uint8_t bpp;
+} lv_font_glyph_dsc_t;
+
+typedef struct _lv_font_t {
+    bool (*get_glyph_dsc)(const struct _lv_font_t *, lv_font_glyph_dsc_t *, uint32_t letter,
+                          uint32_t letter_next);
+    const uint8_t *(*get_glyph_bitmap)(const struct _lv_font_t *, uint32_t letter);
+    lv_coord_t line_height;
+    lv_coord_t base_line;
+    uint8_t subpx : 2;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    const void *dsc;
+    const struct _lv_font_t *fallback;
+    void *user_data;
+} lv_font_t;
+
+#define LV_FONT_DECLARE(font_name) extern const lv_font_t font_name;
+
+bool lv_font_get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out, uint32_t letter,
+                           uint32_t letter_next);
+const uint8_t *lv_font_get_glyph_bitmap(const lv_font_t *font, uint32_t letter);
+uint16_t lv_font_get_glyph_width(const lv_font_t *font, uint32_t letter, uint32_t letter_next);
+
+typedef struct {
+    uint32_t bitmap_index : 20;
+    uint32_t adv_w : 12;
+    uint8_t box_w;
+    uint8_t box_h;
+    int8_t ofs_x;
+    int8_t ofs_y;
+} lv_font_fmt_txt_glyph_dsc_t;
+
+enum {
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_FULL,
+    LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY,
+    LV_FONT_FMT_TXT_CMAP_SPARSE_TINY,
+};
+typedef uint8_t lv_font_fmt_txt_cmap_type_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    const uint16_t *unicode_list;
+    const void *glyph_id_ofs_list;
+    uint16_t list_length;
+    lv_font_fmt_txt_cmap_type_t type;
+} lv_font_fmt_txt_cmap_t;
+
+typedef struct {
+    uint32_t last_letter;
+    uint32_t last_glyph_id;
+} lv_font_fmt_txt_glyph_cache_t;
+
+typedef struct {
+    const uint8_t *glyph_bitmap;
+    const lv_font_fmt_txt_glyph_dsc_t *glyph_dsc;
+    const lv_font_fmt_txt_cmap_t *cmaps;
+    const void *kern_dsc;
+    uint16_t kern_scale;
+    uint16_t cmap_num : 9;
+    uint16_t bpp : 4;
+    uint16_t kern_classes : 1;
+    uint16_t bitmap_format : 2;
+    lv_font_fmt_txt_glyph_cache_t *cache;
+} lv_font_fmt_txt_dsc_t;
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                   uint32_t letter, uint32_t letter_next);
+const uint8_t *lv_font_get_bitmap_fmt_txt(const lv_font_t *font, uint32_t letter);
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+enum display_pixel_format {
+    PIXEL_FORMAT_RGB_888 = 1,
+    PIXEL_FORMAT_MONO01 = 2,
+    PIXEL_FORMAT_MONO10 = 4,
+};
+
+#define SCREEN_INFO_MONO_VTILED BIT(0)
+#define SCREEN_INFO_MONO_MSB_FIRST BIT(1)
+#define SCREEN_INFO_EPD BIT(2)
+#define SCREEN_INFO_X_ALIGNMENT_WIDTH BIT(4)
+
+struct display_capabilities {
+    uint16_t x_resolution;
+    uint16_t y_resolution;
+    uint32_t supported_pixel_formats;
+    uint32_t screen_info;
+    enum display_pixel_format current_pixel_format;
+};
+
+struct display_buffer_descriptor {
+    uint32_t buf_size;
+    uint16_t width;
+    uint16_t height;
+    uint16_t pitch;
+};
+
+void display_get_capabilities(const struct device *dev, struct display_capabilities *caps);
+int display_write(const struct device *dev, uint16_t x, uint16_t y,
+                  const struct display_buffer_descriptor *desc, const void *buf);
@@ -0,0 +1,139 @@
+#pragma once
+
+// Zephyr kernel stand-ins for the host builds. Work items run on a single queue against a
+// virtual millisecond clock, both driven by the test through host.h.
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// IS_ENABLED() as in zephyr/sys/util_macro.h: 1 if the option is defined to 1, else 0
+#define _XXXX1 _YYYY,
+#define IS_ENABLED(config) _IS_ENABLED1(config)
+#define _IS_ENABLED1(config) _IS_ENABLED2(_XXXX##config)
+#define _IS_ENABLED2(one_or_two_args) _IS_ENABLED3(one_or_two_args 1, 0)
+#define _IS_ENABLED3(ignore_this, val, ...) val
+
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define CLAMP(val, low, high) (((val) <= (low)) ? (low) : MIN(val, high))
+#define ABS(a) ((a) < 0 ? -(a) : (a))
+#define BIT(n) (1UL << (n))
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+#define CONTAINER_OF(ptr, type, field) ((type *)(((char *)(ptr)) - offsetof(type, field)))
+
+#define BUILD_ASSERT(cond, msg) _Static_assert(cond, msg)
+#define __ASSERT(cond, fmt, ...)                                                                   \
+    do {                                                                                           \
+        if (!(cond)) {                                                                             \
+            fprintf(stderr, "%s:%d: " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__);               \
+            abort();                                                                               \
+        }                                                                                          \
+    } while (0)
+
+/**
+ * Atomics, single threaded
+ **/
+
+typedef long atomic_t;
+typedef long atomic_val_t;
+
+#define ATOMIC_INIT(value) (value)
+
+static inline atomic_val_t atomic_get(const atomic_t *target) { return *target; }
+
+static inline atomic_val_t atomic_set(atomic_t *target, atomic_val_t value) {
+    atomic_val_t old = *target;
+    *target = value;
+    return old;
+}
+
+/**
+ * Time
+ **/
+
+typedef struct {
+    int64_t ms;
+} k_timeout_t;
+
+#define K_NO_WAIT ((k_timeout_t){0})
+#define K_MSEC(ms) ((k_timeout_t){(ms)})
+#define K_SECONDS(s) K_MSEC((s) * 1000)
+
+// long long, which int64_t is on the target, so log formats match
+long long k_uptime_get(void);
+
+static inline uint32_t k_uptime_get_32(void) { return (uint32_t)k_uptime_get(); }
+
+/**
+ * Work queue
+ **/
+
+struct k_work;
+typedef void (*k_work_handler_t)(struct k_work *work);
+
+struct k_work_q {
+    int unused;
+};
+
+struct k_work {
+    k_work_handler_t handler;
+    struct k_work *next;
+    bool queued;
+};
+
+struct k_work_delayable {
+    struct k_work work;
+    struct k_work_delayable *next_timer;
+    int64_t due;
+    bool scheduled;
+    bool registered;
+};
+
+#define K_WORK_DEFINE(name, work_handler) struct k_work name = {.handler = work_handler}
+
+void k_work_init(struct k_work *work, k_work_handler_t handler);
+int k_work_submit_to_queue(struct k_work_q *queue, struct k_work *work);
+void k_work_init_delayable(struct k_work_delayable *dwork, k_work_handler_t handler);
+int k_work_schedule_for_queue(struct k_work_q *queue, struct k_work_delayable *dwork,
+                              k_timeout_t delay);
+bool k_work_delayable_is_pending(const struct k_work_delayable *dwork);
+
+static inline struct k_work_delayable *k_work_delayable_from_work(struct k_work *work) {
+    return CONTAINER_OF(work, struct k_work_delayable, work);
+}
+
+/**
+ * Singly linked list
+ **/
+
+typedef struct _snode {
+    struct _snode *next;
+} sys_snode_t;
+
+typedef struct {
+    sys_snode_t *head;
+    sys_snode_t *tail;
+} sys_slist_t;
+
+#define SYS_SLIST_STATIC_INIT(ptr_to_list) {NULL, NULL}
+
+static inline void sys_slist_append(sys_slist_t *list, sys_snode_t *node) {
+    node->next = NULL;
+    if (list->tail != NULL) {
+        list->tail->next = node;
+    } else {
+        list->head = node;
+    }
+    list->tail = node;
+}
+
+#define SYS_SLIST_FOR_EACH_CONTAINER(list, container, field)                                       \
+    for (sys_snode_t *_node = (list)->head;                                                        \
+         _node != NULL &&                                                                          \
+         ((container) = CONTAINER_OF(_node, __typeof__(*(container)), field));                     \
+         _node = _node->next)
@@ -0,0 +1,12 @@
+#pragma once
+
+#define LOG_MODULE_DECLARE(...)
+#define LOG_MODULE_REGISTER(...)
+
+// Printed with HOST_LOG=1 in the environment
+void host_log(const char *level, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+#define LOG_ERR(...) host_log("err", __VA_ARGS__)
+#define LOG_WRN(...) host_log("wrn", __VA_ARGS__)
+#define LOG_INF(...) host_log("inf", __VA_ARGS__)
+#define LOG_DBG(...) host_log("dbg", __VA_ARGS__)
@@ -0,0 +1,30 @@
+#pragma once
+
+// Settings handlers register at startup, and host_settings_set() in host.h feeds them a value as
+// if it had just been loaded
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+typedef ssize_t (*settings_read_cb)(void *cb_arg, void *data, size_t len);
+
+struct settings_handler_static {
+    const char *name;
+    int (*h_get)(const char *key, char *val, int val_len_max);
+    int (*h_set)(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg);
+    int (*h_commit)(void);
+    int (*h_export)(int (*export_func)(const char *name, const void *val, size_t val_len));
+};
+
+void host_settings_register(const struct settings_handler_static *handler);
+
+#define SETTINGS_STATIC_HANDLER_DEFINE(_hname, _tree, _get, _set, _commit, _export)               \
+    static const struct settings_handler_static settings_handler_##_hname = {                      \
+        .name = _tree, .h_get = _get, .h_set = _set, .h_commit = _commit, .h_export = _export};    \
+    __attribute__((constructor)) static void settings_register_##_hname(void) {                    \
+        host_settings_register(&settings_handler_##_hname);                                        \
+    }
+
+int settings_name_steq(const char *name, const char *key, const char **next);
+int settings_save_one(const char *name, const void *value, size_t val_len);
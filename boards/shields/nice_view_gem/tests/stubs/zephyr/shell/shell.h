@@ -0,0 +1,3 @@
+#pragma once
+
+// The host builds have no shell, CONFIG_SHELL is unset and the commands are left out
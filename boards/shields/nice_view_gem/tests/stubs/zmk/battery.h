@@ -0,0 +1,5 @@
+#pragma once
+
+#include <stdint.h>
+
+uint8_t zmk_battery_state_of_charge(void);
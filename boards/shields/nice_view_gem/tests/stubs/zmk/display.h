@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdbool.h>
+#include <zephyr/kernel.h>
+#include <zmk/event_manager.h>
+
+struct k_work_q *zmk_display_work_q(void);
+bool zmk_display_is_initialized(void);
+
+// As in ZMK, less the mutex around the state, which the single threaded host does not need
+#define ZMK_DISPLAY_WIDGET_LISTENER(listener, state_type, cb, state_func)                          \
+    static state_type __##listener##_state;                                                        \
+    static void listener##_work_cb(struct k_work *work) { cb(__##listener##_state); }              \
+    K_WORK_DEFINE(listener##_work, listener##_work_cb);                                            \
+    static void listener##_refresh(void) {                                                         \
+        __##listener##_state = state_func(NULL);                                                   \
+        cb(__##listener##_state);                                                                  \
+    }                                                                                              \
+    static int listener##_cb(const zmk_event_t *eh) {                                              \
+        if (zmk_display_is_initialized()) {                                                        \
+            __##listener##_state = state_func(eh);                                                 \
+            k_work_submit_to_queue(zmk_display_work_q(), &listener##_work);                        \
+        }                                                                                          \
+        return ZMK_EV_EVENT_BUBBLE;                                                                \
+    }                                                                                              \
+    ZMK_LISTENER(listener, listener##_cb);                                                         \
+    static void listener##_init(void) { listener##_refresh(); }
@@ -0,0 +1,59 @@
+#pragma once
+
+// The event manager calls every subscribed listener in the raising thread, like ZMK does
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+struct zmk_event_type {
+    const char *name;
+};
+
+typedef struct {
+    const struct zmk_event_type *event;
+    uint8_t last_listener_index;
+} zmk_event_t;
+
+#define ZMK_EV_EVENT_BUBBLE 0
+#define ZMK_EV_EVENT_HANDLED 1
+#define ZMK_EV_EVENT_CAPTURED 2
+
+typedef int (*zmk_listener_callback_t)(const zmk_event_t *eh);
+
+struct zmk_listener {
+    zmk_listener_callback_t callback;
+};
+
+void zmk_event_manager_subscribe(const struct zmk_event_type *event,
+                                 const struct zmk_listener *listener);
+int zmk_event_manager_raise(zmk_event_t *event);
+
+#define ZMK_EVENT_DECLARE(event_type)                                                              \
+    struct event_type##_event {                                                                    \
+        zmk_event_t header;                                                                        \
+        struct event_type data;                                                                    \
+    };                                                                                             \
+    extern const struct zmk_event_type zmk_event_##event_type;                                     \
+    static inline struct event_type *as_##event_type(const zmk_event_t *eh) {                      \
+        return (eh != NULL && eh->event == &zmk_event_##event_type)                                \
+                   ? &((struct event_type##_event *)eh)->data                                      \
+                   : NULL;                                                                         \
+    }                                                                                              \
+    int raise_##event_type(struct event_type data);
+
+#define ZMK_EVENT_IMPL(event_type)                                                                 \
+    const struct zmk_event_type zmk_event_##event_type = {.name = #event_type};                    \
+    int raise_##event_type(struct event_type data) {                                               \
+        struct event_type##_event ev = {                                                           \
+            .header = {.event = &zmk_event_##event_type},                                          \
+            .data = data,                                                                          \
+        };                                                                                         \
+        return zmk_event_manager_raise(&ev.header);                                                \
+    }
+
+#define ZMK_LISTENER(mod, cb) const struct zmk_listener zmk_listener_##mod = {.callback = cb};
+
+#define ZMK_SUBSCRIPTION(mod, ev_type)                                                             \
+    __attribute__((constructor)) static void zmk_subscription_##mod##_##ev_type(void) {            \
+        zmk_event_manager_subscribe(&zmk_event_##ev_type, &zmk_listener_##mod);                    \
+    }
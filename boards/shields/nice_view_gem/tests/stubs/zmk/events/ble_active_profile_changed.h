@@ -0,0 +1,9 @@
+#pragma once
+
+#include <zmk/event_manager.h>
+
+struct zmk_ble_active_profile_changed {
+    uint8_t index;
+};
+
+ZMK_EVENT_DECLARE(zmk_ble_active_profile_changed);
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <zmk/event_manager.h>
+
+struct zmk_wpm_state_changed {
+    int state;
+};
+
+ZMK_EVENT_DECLARE(zmk_wpm_state_changed);
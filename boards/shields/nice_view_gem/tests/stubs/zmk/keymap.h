@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdint.h>
+
+// Layers of the host keymap, see host_keyboard in host.h
+#ifndef ZMK_KEYMAP_LAYERS_LEN
+#define ZMK_KEYMAP_LAYERS_LEN 4
+#endif
+
+uint8_t zmk_keymap_highest_layer_active(void);
+const char *zmk_keymap_layer_name(uint8_t layer);
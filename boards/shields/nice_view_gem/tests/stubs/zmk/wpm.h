@@ -0,0 +1,3 @@
+#pragma once
+
+int zmk_wpm_get_state(void);
@@ -1,48 +1,189 @@
 #include <stdlib.h>
 #include <zephyr/kernel.h>
 #include "animation.h"
+#include "framebuffer.h"
+#include "governor.h"
+#include "orientation.h"
+#include "render_stats.h"
+#include "rle.h"
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION_PROCEDURAL)
+#include "crystal.h"
+
+BUILD_ASSERT(CRYSTAL_WIDTH == ANIMATION_WIDTH && CRYSTAL_HEIGHT == ANIMATION_HEIGHT,
+             "Crystal model does not match the animation layout");
+#else
+#include "../assets/delta_anim.h"
+
+extern const struct delta_anim crystal;
+#endif
+
+BUILD_ASSERT(ANIMATION_PERIOD > 0, "More animation frames than milliseconds");
+
+// Frames are stored as drawn at 270 degrees. At 90 degrees each is shown turned upside down
+// from a second buffer, which puts it where region_origin() places a region as tall as the panel.
+BUILD_ASSERT(ANIMATION_HEIGHT == SCREEN_WIDTH, "Animation is not as tall as the panel");
+
+static uint8_t art_buf[CANVAS_PALETTE_SIZE + PACKED_SIZE(ANIMATION_WIDTH, ANIMATION_HEIGHT)];
+static uint8_t flipped_buf[CANVAS_PALETTE_SIZE + PACKED_SIZE(ANIMATION_WIDTH, ANIMATION_HEIGHT)];
+static uint16_t frame;
+
+#if !IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+static lv_obj_t *art;
+#endif
 
-LV_IMG_DECLARE(crystal_01);
-LV_IMG_DECLARE(crystal_02);
-LV_IMG_DECLARE(crystal_03);
-LV_IMG_DECLARE(crystal_04);
-LV_IMG_DECLARE(crystal_05);
-LV_IMG_DECLARE(crystal_06);
-LV_IMG_DECLARE(crystal_07);
-LV_IMG_DECLARE(crystal_08);
-LV_IMG_DECLARE(crystal_09);
-LV_IMG_DECLARE(crystal_10);
-LV_IMG_DECLARE(crystal_11);
-LV_IMG_DECLARE(crystal_12);
-LV_IMG_DECLARE(crystal_13);
-LV_IMG_DECLARE(crystal_14);
-LV_IMG_DECLARE(crystal_15);
-LV_IMG_DECLARE(crystal_16);
-
-const lv_img_dsc_t *anim_imgs[] = {
-    &crystal_01, &crystal_02, &crystal_03, &crystal_04, &crystal_05, &crystal_06,
-    &crystal_07, &crystal_08, &crystal_09, &crystal_10, &crystal_11, &crystal_12,
-    &crystal_13, &crystal_14, &crystal_15, &crystal_16,
-};
-
-void draw_animation(lv_obj_t *canvas) {
 #if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION)
-    lv_obj_t *art = lv_animimg_create(canvas);
-    lv_obj_center(art);
+static lv_timer_t *timer;
+static uint32_t frames_shown;
+#endif
+
+#if !IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION_PROCEDURAL)
+// XORs delta index into the frame, touching only the rows and byte columns it changes
+static void apply_delta(uint8_t *pixels, const struct delta_anim *anim, uint8_t index) {
+    const struct delta_frame *delta = &anim->deltas[index];
+    const uint8_t *data = anim->data + delta->offset;
+    uint16_t stride = PACKED_STRIDE(anim->w);
 
-    lv_animimg_set_src(art, (const void **)anim_imgs, 16);
-    lv_animimg_set_duration(art, CONFIG_NICE_VIEW_GEM_ANIMATION_MS);
-    lv_animimg_set_repeat_count(art, LV_ANIM_REPEAT_INFINITE);
-    lv_animimg_start(art);
+    for (uint16_t y = delta->y; y < delta->y + delta->h; y++) {
+        uint8_t *row = pixels + y * stride + (*data >> 4);
+        uint8_t count = *data++ & 0x0F;
+
+        while (count--) {
+            *row++ ^= *data++;
+        }
+    }
+}
+#endif
+
+static bool flipped(void) { return display_orientation() == ORIENTATION_90; }
+
+// Brings the frame rectangle (x, y, w, h) to the panel, turning its rows over first if flipped
+static void show_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    uint16_t stride = PACKED_STRIDE(ANIMATION_WIDTH);
+    const uint8_t *pixels = art_buf + CANVAS_PALETTE_SIZE;
+
+    if (flipped()) {
+        // Rows [y, y + h) land at the other end of the flipped frame
+        uint16_t top = ANIMATION_HEIGHT - y - h;
+
+        rotate_1bpp_180(pixels + y * stride, stride, ANIMATION_WIDTH, h,
+                        flipped_buf + CANVAS_PALETTE_SIZE + top * stride, stride);
+        pixels = flipped_buf + CANVAS_PALETTE_SIZE;
+        x = ANIMATION_WIDTH - x - w;
+        y = top;
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    int16_t left, origin_y;
+
+    // Whole rows are copied, and only lines that change are written
+    region_origin(ANIMATION_X, ANIMATION_Y, ANIMATION_WIDTH, &left, &origin_y);
+    framebuffer_blit(pixels + y * stride, stride, left, origin_y + y, ANIMATION_WIDTH, h, NULL,
+                     lv_color_to1(LVGL_FOREGROUND));
 #else
-    lv_obj_t *art = lv_img_create(canvas);
+    lv_area_t area;
+
+    lv_obj_get_coords(art, &area);
+    area.x1 += x;
+    area.y1 += y;
+    area.x2 = area.x1 + w - 1;
+    area.y2 = area.y1 + h - 1;
+    lv_obj_invalidate_area(art, &area);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION)
+static void next_frame(lv_timer_t *timer) {
+    RENDER_STATS_START(start);
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION_PROCEDURAL)
+    struct crystal_rect changed;
 
-    int length = sizeof(anim_imgs) / sizeof(anim_imgs[0]);
+    frame = (frame + 1) % ANIMATION_FRAMES;
+    crystal_render(art_buf + CANVAS_PALETTE_SIZE, frame, ANIMATION_FRAMES, &changed);
+    RENDER_STATS_RECORD(RENDER_STAT_ANIMATION, start);
+    frames_shown++;
+
+    // Only the rectangle the crystal moved in is redrawn and flushed
+    show_rect(changed.x, changed.y, changed.w, changed.h);
+#else
+    const struct delta_frame *delta = &crystal.deltas[frame];
+
+    apply_delta(art_buf + CANVAS_PALETTE_SIZE, &crystal, frame);
+    RENDER_STATS_RECORD(RENDER_STAT_ANIMATION, start);
+    frame = (frame + 1) % crystal.count;
+    frames_shown++;
+
+    // Only the delta's rectangle is redrawn and flushed
+    show_rect(delta->x, delta->y, delta->w, delta->h);
+#endif
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    framebuffer_flush();
+#endif
+}
+
+void animation_set_period(uint32_t period) {
+    if (period == 0) {
+        lv_timer_pause(timer);
+        return;
+    }
+
+    lv_timer_set_period(timer, period);
+    if (timer->paused) {
+        // Step straight away instead of waiting a full period after a freeze
+        lv_timer_resume(timer);
+        lv_timer_ready(timer);
+    }
+}
+
+uint32_t animation_take_frame_count(void) {
+    uint32_t count = frames_shown;
+    frames_shown = 0;
+    return count;
+}
+#endif
+
+void place_animation(void) {
+#if !IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    int16_t x, y;
+
+    region_origin(ANIMATION_X, ANIMATION_Y, ANIMATION_WIDTH, &x, &y);
+    lv_canvas_set_buffer(art, flipped() ? flipped_buf : art_buf, ANIMATION_WIDTH,
+                         ANIMATION_HEIGHT, LV_IMG_CF_INDEXED_1BIT);
+    lv_canvas_set_palette(art, 0, LVGL_BACKGROUND);
+    lv_canvas_set_palette(art, 1, LVGL_FOREGROUND);
+    lv_obj_align(art, LV_ALIGN_TOP_LEFT, x, y);
+#endif
+
+    show_rect(0, 0, ANIMATION_WIDTH, ANIMATION_HEIGHT);
+}
+
+void draw_animation(lv_obj_t *parent) {
+#if !IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    art = lv_canvas_create(parent);
+#endif
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION)
+    timer = lv_timer_create(next_frame, ANIMATION_PERIOD, NULL);
+    animation_governor_init();
+#else
     srand(k_uptime_get_32());
-    int random_index = rand() % length;
+    frame = rand() % ANIMATION_FRAMES;
+#endif
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION_PROCEDURAL)
+    struct crystal_rect changed;
+
+    crystal_render(art_buf + CANVAS_PALETTE_SIZE, frame, ANIMATION_FRAMES, &changed);
+#else
+    __ASSERT(crystal.w == ANIMATION_WIDTH && crystal.h == ANIMATION_HEIGHT &&
+                 crystal.count == ANIMATION_FRAMES,
+             "Crystal frames do not match the animation layout");
+    rle_decode(crystal.keyframe, art_buf + CANVAS_PALETTE_SIZE, PACKED_SIZE(crystal.w, crystal.h));
 
-    lv_img_set_src(art, anim_imgs[random_index]);
+    for (uint16_t i = 0; i < frame; i++) {
+        apply_delta(art_buf + CANVAS_PALETTE_SIZE, &crystal, i);
+    }
 #endif
 
-    lv_obj_align(art, LV_ALIGN_BOTTOM_RIGHT, -36, -2);
-}
\ No newline at end of file
+    place_animation();
+}
@@ -4,4 +4,15 @@
 #include "util.h"
 #include "screen_peripheral.h"
 
-void draw_animation(lv_obj_t *canvas);
+// Full rate time between two crystal frames
+#define ANIMATION_PERIOD (CONFIG_NICE_VIEW_GEM_ANIMATION_MS / ANIMATION_FRAMES)
+
+void draw_animation(lv_obj_t *parent);
+// Moves the animation to its place for the current orientation and shows the current frame
+void place_animation(void);
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION)
+// A period of 0 freezes the animation on its current frame
+void animation_set_period(uint32_t period);
+uint32_t animation_take_frame_count(void);
+#endif
@@ -1,37 +1,31 @@
 #include <zephyr/kernel.h>
 #include "battery.h"
-#include "../assets/custom_fonts.h"
+#include "digits.h"
+#include "rle.h"
 
-LV_IMG_DECLARE(bolt);
+RLE_IMAGE_DECLARE(bolt);
 
-static void draw_level(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_label_dsc_t label_right_dsc;
-    init_label_dsc(&label_right_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_RIGHT);
+BUILD_ASSERT(RECT_W(LAYOUT_BATTERY_VALUE) >= 4 * DIGIT_CELL_WIDTH, "100% does not fit");
+BUILD_ASSERT(RECT_W(LAYOUT_BATTERY_CHARGING_VALUE) >= 4 * DIGIT_CELL_WIDTH, "100% does not fit");
 
-    char text[10] = {};
-
-    sprintf(text, "%i%%", state->battery);
-    lv_canvas_draw_text(canvas, 26, 19, 42, &label_right_dsc, text);
+static void draw_level(canvas_t *canvas, const struct status_state *state) {
+    draw_number(canvas, RECT_X(LAYOUT_BATTERY_VALUE), RECT_Y(LAYOUT_BATTERY_VALUE),
+                RECT_W(LAYOUT_BATTERY_VALUE), state->battery, true);
 }
 
-static void draw_charging_level(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-    lv_draw_label_dsc_t label_right_dsc;
-    init_label_dsc(&label_right_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_RIGHT);
-
-    char text[10] = {};
-
-    sprintf(text, "%i%%", state->battery);
-    lv_canvas_draw_text(canvas, 26, 19, 35, &label_right_dsc, text);
-    lv_canvas_draw_img(canvas, 62, 21, &bolt, &img_dsc);
+static void draw_charging_level(canvas_t *canvas, const struct status_state *state) {
+    draw_number(canvas, RECT_X(LAYOUT_BATTERY_CHARGING_VALUE),
+                RECT_Y(LAYOUT_BATTERY_CHARGING_VALUE), RECT_W(LAYOUT_BATTERY_CHARGING_VALUE),
+                state->battery, true);
+    canvas_draw_rle(canvas, RECT_X(LAYOUT_BATTERY_BOLT), RECT_Y(LAYOUT_BATTERY_BOLT), &bolt);
 }
 
-void draw_battery_status(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_label_dsc_t label_left_dsc;
-    init_label_dsc(&label_left_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    lv_canvas_draw_text(canvas, 0, 19, 25, &label_left_dsc, "BAT");
+void draw_battery_background(canvas_t *canvas) {
+    canvas_draw_text(canvas, RECT_X(LAYOUT_BATTERY_LABEL), RECT_Y(LAYOUT_BATTERY_LABEL),
+                     RECT_W(LAYOUT_BATTERY_LABEL), LV_TEXT_ALIGN_LEFT, "BAT");
+}
 
+void draw_battery_status(canvas_t *canvas, const struct status_state *state) {
     if (state->charging) {
         draw_charging_level(canvas, state);
     } else {
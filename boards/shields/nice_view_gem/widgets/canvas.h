@@ -0,0 +1,80 @@
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+#include "layout.h"
+#include "orientation.h"
+#include "rotate.h"
+
+/**
+ * Drawing backends
+ *
+ * Widgets draw through the functions below, in region orientation on a scratch canvas
+ * SCREEN_WIDTH pixels wide. By default the scratch canvas is a true color LVGL canvas drawn with
+ * lv_canvas_draw_*, and each region is rotated into an indexed LVGL canvas that LVGL composites
+ * onto the panel. With CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER the scratch canvas is a packed
+ * 1bpp surface, and regions are rotated into buffers that are copied into a panel framebuffer
+ * and written with display_write(), without LVGL objects or its draw pipeline.
+ **/
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+
+// Packed 1bpp drawing surface SCREEN_WIDTH pixels wide, with bits set for white
+struct surface {
+    uint8_t *buf;
+    uint16_t h;
+};
+
+// Panel rectangle a region buffer is copied to: w columns starting at x, and 68 lines starting at
+// y, which may lie partly off the panel
+struct panel_region {
+    int16_t x;
+    int16_t y;
+    uint16_t w;
+};
+
+typedef struct surface canvas_t;
+typedef struct panel_region region_t;
+
+// Region buffers are plain packed rows
+#define CANVAS_PALETTE_SIZE 0
+#define CANVAS_BUF_SIZE(height) PACKED_SIZE(height, SCREEN_WIDTH)
+
+#else
+
+typedef lv_obj_t canvas_t;
+typedef lv_obj_t region_t;
+
+// Region buffers are indexed canvases: height columns, 68 lines
+#define CANVAS_PALETTE_SIZE (2 * sizeof(lv_color32_t))
+#define CANVAS_BUF_SIZE(height) LV_CANVAS_BUF_SIZE_INDEXED_1BIT(height, SCREEN_WIDTH)
+
+#endif
+
+canvas_t *create_scratch_canvas(lv_obj_t *parent);
+// Shrinks the drawing surface to the region about to be drawn
+void resize_scratch(canvas_t *scratch, uint16_t height);
+uint16_t canvas_height(canvas_t *canvas);
+
+region_t *create_region(lv_obj_t *parent, uint8_t cbuf[], uint16_t height);
+// Moves the region to its panel position for the current orientation, see region_origin()
+void place_region(region_t *region, const uint8_t cbuf[], int16_t offset, int16_t align_y);
+uint16_t region_width(region_t *region);
+// Rotates the scratch canvas into the region buffer and returns the number of lines that changed
+uint16_t rotate_canvas(canvas_t *scratch, region_t *region, uint8_t cbuf[]);
+// Schedules the region buffer rows marked in damage for the panel and returns their count
+uint16_t present_rows(region_t *region, const uint8_t cbuf[], const uint8_t damage[]);
+
+// Text is always pixel_operator_mono in the foreground color, on a single line
+void canvas_draw_text(canvas_t *canvas, int16_t x, int16_t y, int16_t w, lv_text_align_t align,
+                      const char *text);
+void canvas_fill_rect(canvas_t *canvas, int16_t x, int16_t y, int16_t w, int16_t h,
+                      lv_color_t color);
+void canvas_draw_line(canvas_t *canvas, const lv_point_t points[], uint16_t count,
+                      lv_color_t color, uint8_t width);
+// Paints the pixels under the set bits of a packed MSB-first bitmap w by h, leaving the rest
+void canvas_draw_bits(canvas_t *canvas, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                      const uint8_t *bits, uint16_t stride, lv_color_t color);
+// Copies rows [y, y + h) to and from packed rows of PACKED_STRIDE(SCREEN_WIDTH), set for white
+void canvas_pack_rows(canvas_t *canvas, uint16_t y, uint16_t h, uint8_t *dst);
+void canvas_unpack_rows(canvas_t *canvas, uint16_t y, uint16_t h, const uint8_t *src);
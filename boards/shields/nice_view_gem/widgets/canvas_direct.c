@@ -0,0 +1,234 @@
+#include <zephyr/kernel.h>
+#include "canvas.h"
+#include "framebuffer.h"
+#include "render_stats.h"
+#include "util.h"
+#include "../assets/custom_fonts.h"
+
+#define SURFACE_STRIDE PACKED_STRIDE(SCREEN_WIDTH)
+
+// Top, middle and bottom
+#define MAX_REGIONS 3
+
+/**
+ * Surfaces
+ **/
+
+static inline void put_pixel(struct surface *surface, int16_t x, int16_t y, bool white) {
+    if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= surface->h) {
+        return;
+    }
+
+    uint8_t *byte = &surface->buf[y * SURFACE_STRIDE + x / 8];
+    uint8_t mask = 0x80 >> (x % 8);
+    *byte = white ? (*byte | mask) : (*byte & ~mask);
+}
+
+struct surface *create_scratch_canvas(lv_obj_t *parent) {
+    // Shared drawing surface, already in the packed format regions are rotated from
+    static uint8_t scratch_buf[PACKED_SIZE(SCREEN_WIDTH, SCRATCH_HEIGHT)];
+    static struct surface scratch = {.buf = scratch_buf, .h = SCRATCH_HEIGHT};
+
+    return &scratch;
+}
+
+void resize_scratch(struct surface *scratch, uint16_t height) { scratch->h = height; }
+
+uint16_t canvas_height(struct surface *canvas) { return canvas->h; }
+
+/**
+ * Regions
+ **/
+
+struct panel_region *create_region(lv_obj_t *parent, uint8_t cbuf[], uint16_t height) {
+    static struct panel_region regions[MAX_REGIONS];
+    static uint8_t count;
+
+    __ASSERT(count < MAX_REGIONS, "Too many regions");
+    struct panel_region *region = &regions[count++];
+
+    *region = (struct panel_region){.w = height};
+    memset(cbuf, 0, CANVAS_BUF_SIZE(height));
+
+    return region;
+}
+
+void place_region(struct panel_region *region, const uint8_t cbuf[], int16_t offset,
+                  int16_t align_y) {
+    region_origin(offset, align_y, region->w, &region->x, &region->y);
+    // Rotation only presents rows that change, so the panel starts out matching the buffer
+    framebuffer_blit(cbuf, PACKED_STRIDE(region->w), region->x, region->y, region->w, SCREEN_WIDTH,
+                     NULL, true);
+}
+
+uint16_t region_width(struct panel_region *region) { return region->w; }
+
+uint16_t present_rows(struct panel_region *region, const uint8_t cbuf[], const uint8_t damage[]) {
+    uint16_t changed = 0;
+
+    framebuffer_blit(cbuf, PACKED_STRIDE(region->w), region->x, region->y, region->w,
+                     SCREEN_WIDTH, damage, true);
+
+    for (uint16_t y = 0; y < SCREEN_WIDTH; y++) {
+        changed += damage[y] != 0;
+    }
+
+    return changed;
+}
+
+uint16_t rotate_canvas(struct surface *scratch, struct panel_region *region, uint8_t cbuf[]) {
+    uint8_t damage[SCREEN_WIDTH] = {0};
+    uint16_t changed;
+
+    RENDER_STATS_START(start);
+
+    // The surface is already packed, so it is rotated in place of a pack and rotate
+    rotate_to_panel(scratch->buf, SURFACE_STRIDE, SCREEN_WIDTH, scratch->h, cbuf,
+                    PACKED_STRIDE(scratch->h), damage);
+    changed = present_rows(region, cbuf, damage);
+
+    RENDER_STATS_RECORD(RENDER_STAT_ROTATE, start);
+    RENDER_STATS_DAMAGE(changed);
+
+    return changed;
+}
+
+/**
+ * Drawing
+ **/
+
+static uint16_t text_width(const lv_font_t *font, const char *text) {
+    uint16_t width = 0;
+
+    for (const char *c = text; *c != '\0'; c++) {
+        width += lv_font_get_glyph_width(font, *c, c[1]);
+    }
+
+    return width;
+}
+
+// Single line, single byte characters, with the label renderer's glyph placement. Pixels outside
+// [x, x + w) are clipped like the label's area clips them.
+void canvas_draw_text(struct surface *canvas, int16_t x, int16_t y, int16_t w,
+                      lv_text_align_t align, const char *text) {
+    const lv_font_t *font = &pixel_operator_mono;
+    bool white = lv_color_to1(LVGL_FOREGROUND);
+    int16_t pen = x;
+
+    if (align == LV_TEXT_ALIGN_CENTER) {
+        pen += (w - text_width(font, text)) / 2;
+    } else if (align == LV_TEXT_ALIGN_RIGHT) {
+        pen += w - text_width(font, text);
+    }
+
+    for (const char *c = text; *c != '\0'; c++) {
+        lv_font_glyph_dsc_t glyph;
+
+        if (!lv_font_get_glyph_dsc(font, &glyph, *c, c[1])) {
+            continue;
+        }
+
+        const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, *c);
+        int16_t left = pen + glyph.ofs_x;
+        int16_t top = y + font->line_height - font->base_line - glyph.box_h - glyph.ofs_y;
+
+        __ASSERT(glyph.bpp == 1, "Only 1 bpp fonts are supported");
+
+        // Font bitmaps are packed bit by bit, without padding at the end of rows
+        for (uint16_t gy = 0; gy < glyph.box_h; gy++) {
+            for (uint16_t gx = 0; gx < glyph.box_w; gx++) {
+                uint32_t bit = gy * glyph.box_w + gx;
+                int16_t px = left + gx;
+
+                if ((bitmap[bit / 8] & (0x80 >> (bit % 8))) && px >= x && px < x + w) {
+                    put_pixel(canvas, px, top + gy, white);
+                }
+            }
+        }
+
+        pen += glyph.adv_w;
+    }
+}
+
+void canvas_fill_rect(struct surface *canvas, int16_t x, int16_t y, int16_t w, int16_t h,
+                      lv_color_t color) {
+    bool white = lv_color_to1(color);
+
+    // Full width rows are filled a byte at a time, including the padding bits at their end
+    if (x == 0 && w == SCREEN_WIDTH && y >= 0 && y + h <= canvas->h) {
+        memset(canvas->buf + y * SURFACE_STRIDE, white ? 0xFF : 0x00, h * SURFACE_STRIDE);
+        return;
+    }
+
+    for (int16_t py = y; py < y + h; py++) {
+        for (int16_t px = x; px < x + w; px++) {
+            put_pixel(canvas, px, py, white);
+        }
+    }
+}
+
+// Bresenham segment drawn with a square brush as wide as the line. Skewed lines wider than a
+// pixel can come out a pixel off from LVGL's, which anti-aliases them at higher color depths.
+static void draw_segment(struct surface *canvas, lv_point_t a, lv_point_t b, bool white,
+                         uint8_t width) {
+    int16_t dx = ABS(b.x - a.x);
+    int16_t dy = -ABS(b.y - a.y);
+    int16_t sx = a.x < b.x ? 1 : -1;
+    int16_t sy = a.y < b.y ? 1 : -1;
+    int16_t err = dx + dy;
+    // Same split of the width around the point as LVGL's horizontal and vertical lines
+    int16_t lo = -(((width - 1) >> 1) + ((width - 1) & 1));
+    int16_t hi = (width - 1) >> 1;
+
+    while (true) {
+        for (int16_t oy = lo; oy <= hi; oy++) {
+            for (int16_t ox = lo; ox <= hi; ox++) {
+                put_pixel(canvas, a.x + ox, a.y + oy, white);
+            }
+        }
+
+        if (a.x == b.x && a.y == b.y) {
+            break;
+        }
+
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            a.x += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            a.y += sy;
+        }
+    }
+}
+
+void canvas_draw_line(struct surface *canvas, const lv_point_t points[], uint16_t count,
+                      lv_color_t color, uint8_t width) {
+    bool white = lv_color_to1(color);
+
+    for (uint16_t i = 1; i < count; i++) {
+        draw_segment(canvas, points[i - 1], points[i], white, width);
+    }
+}
+
+void canvas_draw_bits(struct surface *canvas, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                      const uint8_t *bits, uint16_t stride, lv_color_t color) {
+    bool white = lv_color_to1(color);
+
+    for (uint16_t row = 0; row < h; row++, bits += stride) {
+        for (uint16_t col = 0; col < w; col++) {
+            if (bits[col / 8] & (0x80 >> (col % 8))) {
+                put_pixel(canvas, x + col, y + row, white);
+            }
+        }
+    }
+}
+
+void canvas_pack_rows(struct surface *canvas, uint16_t y, uint16_t h, uint8_t *dst) {
+    memcpy(dst, canvas->buf + y * SURFACE_STRIDE, h * SURFACE_STRIDE);
+}
+
+void canvas_unpack_rows(struct surface *canvas, uint16_t y, uint16_t h, const uint8_t *src) {
+    memcpy(canvas->buf + y * SURFACE_STRIDE, src, h * SURFACE_STRIDE);
+}
@@ -0,0 +1,167 @@
+#include <zephyr/kernel.h>
+#include "canvas.h"
+#include "render_stats.h"
+#include "util.h"
+#include "../assets/custom_fonts.h"
+
+/**
+ * Canvases
+ **/
+
+canvas_t *create_scratch_canvas(lv_obj_t *parent) {
+    // Shared drawing surface: LVGL can only draw into true color canvases, so every region is
+    // drawn here and then packed into its own 1bpp canvas buffer.
+    static lv_color_t scratch_buf[SCREEN_WIDTH * SCRATCH_HEIGHT];
+
+    lv_obj_t *scratch = lv_canvas_create(parent);
+    lv_obj_add_flag(scratch, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_buffer(scratch, scratch_buf, SCREEN_WIDTH, SCRATCH_HEIGHT,
+                         LV_IMG_CF_TRUE_COLOR);
+
+    return scratch;
+}
+
+void resize_scratch(lv_obj_t *scratch, uint16_t height) {
+    lv_img_dsc_t *img = lv_canvas_get_img(scratch);
+
+    if (img->header.h != height) {
+        lv_canvas_set_buffer(scratch, (void *)img->data, SCREEN_WIDTH, height,
+                             LV_IMG_CF_TRUE_COLOR);
+    }
+}
+
+uint16_t canvas_height(lv_obj_t *canvas) { return lv_canvas_get_img(canvas)->header.h; }
+
+/**
+ * Regions
+ **/
+
+lv_obj_t *create_region(lv_obj_t *parent, uint8_t cbuf[], uint16_t height) {
+    lv_obj_t *canvas = lv_canvas_create(parent);
+
+    lv_canvas_set_buffer(canvas, cbuf, height, SCREEN_WIDTH, LV_IMG_CF_INDEXED_1BIT);
+    // Palette follows pack_1bpp(), which stores lv_color_to1() of each pixel
+    lv_canvas_set_palette(canvas, 0, lv_color_black());
+    lv_canvas_set_palette(canvas, 1, lv_color_white());
+
+    return canvas;
+}
+
+void place_region(lv_obj_t *region, const uint8_t cbuf[], int16_t offset, int16_t align_y) {
+    int16_t x, y;
+
+    region_origin(offset, align_y, region_width(region), &x, &y);
+    // The canvas is as tall as the screen object, so its bottom left alignment is its position
+    lv_obj_align(region, LV_ALIGN_BOTTOM_LEFT, x, y);
+}
+
+uint16_t region_width(lv_obj_t *region) { return lv_canvas_get_img(region)->header.w; }
+
+// Invalidates each run of changed canvas rows. Canvas rows are physical lines of the
+// line-addressed memory LCD, so only those lines are flushed.
+uint16_t present_rows(lv_obj_t *region, const uint8_t cbuf[], const uint8_t damage[]) {
+    lv_area_t coords;
+    uint16_t changed = 0;
+
+    lv_obj_get_coords(region, &coords);
+
+    for (uint16_t y = 0; y < SCREEN_WIDTH;) {
+        if (damage[y] == 0) {
+            y++;
+            continue;
+        }
+
+        uint16_t start = y;
+        while (y < SCREEN_WIDTH && damage[y] != 0) {
+            y++;
+        }
+
+        lv_area_t area = {coords.x1, coords.y1 + start, coords.x2, coords.y1 + y - 1};
+        lv_obj_invalidate_area(region, &area);
+        changed += y - start;
+    }
+
+    return changed;
+}
+
+uint16_t rotate_canvas(lv_obj_t *scratch, lv_obj_t *region, uint8_t cbuf[]) {
+    static uint8_t packed[PACKED_SIZE(SCREEN_WIDTH, SCRATCH_HEIGHT)];
+    uint8_t damage[SCREEN_WIDTH] = {0};
+    const lv_img_dsc_t *img = lv_canvas_get_img(scratch);
+    uint16_t height = img->header.h;
+    uint8_t *dst = cbuf + CANVAS_PALETTE_SIZE;
+    uint16_t changed;
+
+    RENDER_STATS_START(start);
+
+    // Rotate in 1bpp straight into the display canvas, skipping the palette
+    pack_1bpp(img->data, SCREEN_WIDTH, height, packed, PACKED_STRIDE(SCREEN_WIDTH));
+    rotate_to_panel(packed, PACKED_STRIDE(SCREEN_WIDTH), SCREEN_WIDTH, height, dst,
+                    PACKED_STRIDE(height), damage);
+    changed = present_rows(region, cbuf, damage);
+
+    RENDER_STATS_RECORD(RENDER_STAT_ROTATE, start);
+    RENDER_STATS_DAMAGE(changed);
+
+    return changed;
+}
+
+/**
+ * Drawing
+ **/
+
+void canvas_draw_text(lv_obj_t *canvas, int16_t x, int16_t y, int16_t w, lv_text_align_t align,
+                      const char *text) {
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.color = LVGL_FOREGROUND;
+    label_dsc.font = &pixel_operator_mono;
+    label_dsc.align = align;
+
+    lv_canvas_draw_text(canvas, x, y, w, &label_dsc, text);
+}
+
+void canvas_fill_rect(lv_obj_t *canvas, int16_t x, int16_t y, int16_t w, int16_t h,
+                      lv_color_t color) {
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = color;
+
+    lv_canvas_draw_rect(canvas, x, y, w, h, &rect_dsc);
+}
+
+void canvas_draw_line(lv_obj_t *canvas, const lv_point_t points[], uint16_t count,
+                      lv_color_t color, uint8_t width) {
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = color;
+    line_dsc.width = width;
+
+    lv_canvas_draw_line(canvas, points, count, &line_dsc);
+}
+
+void canvas_draw_bits(lv_obj_t *canvas, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                      const uint8_t *bits, uint16_t stride, lv_color_t color) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    lv_color_t *pixels = (lv_color_t *)img->data + y * img->header.w + x;
+
+    for (uint16_t row = 0; row < h; row++, bits += stride, pixels += img->header.w) {
+        for (uint16_t col = 0; col < w; col++) {
+            if (bits[col / 8] & (0x80 >> (col % 8))) {
+                pixels[col] = color;
+            }
+        }
+    }
+}
+
+void canvas_pack_rows(lv_obj_t *canvas, uint16_t y, uint16_t h, uint8_t *dst) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    pack_1bpp((const lv_color_t *)img->data + y * SCREEN_WIDTH, SCREEN_WIDTH, h, dst,
+              PACKED_STRIDE(SCREEN_WIDTH));
+}
+
+void canvas_unpack_rows(lv_obj_t *canvas, uint16_t y, uint16_t h, const uint8_t *src) {
+    const lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    unpack_1bpp(src, PACKED_STRIDE(SCREEN_WIDTH), SCREEN_WIDTH, h,
+                (lv_color_t *)img->data + y * SCREEN_WIDTH);
+}
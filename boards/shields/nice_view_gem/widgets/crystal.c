@@ -0,0 +1,314 @@
+// Plain C without Zephyr headers, so tests/crystal_bench.c can build it on the host
+#include <stdbool.h>
+#include <string.h>
+#include "crystal.h"
+
+#define STRIDE ((CRYSTAL_WIDTH + 7) / 8)
+
+// Coordinates are in sixteenths of a pixel, angles in 1/65536 turns and sines in Q14
+#define SUBPIXEL 16
+#define Q14 14
+#define TURN 0x10000
+
+/**
+ * Model
+ **/
+
+// Ring vertices around the equator, so the spin repeats every 1 / SIDES turn
+#define SIDES 4
+#define RADIUS (30 * SUBPIXEL)
+#define TOP_HEIGHT (16 * SUBPIXEL)
+#define BOTTOM_HEIGHT (18 * SUBPIXEL)
+#define CENTER_X (34 * SUBPIXEL + SUBPIXEL / 2)
+#define CENTER_Y (34 * SUBPIXEL)
+
+// The spin axis leans 15 degrees towards the viewer to show the upper faces
+#define TILT_COS 15826
+#define TILT_SIN 4240
+
+#define VERTEX_TOP 0
+#define VERTEX_BOTTOM 1
+#define VERTEX_RING 2
+#define VERTEX_COUNT (VERTEX_RING + SIDES)
+#define FACE_COUNT (2 * SIDES)
+
+// Light from the upper left front, in screen axes with z towards the viewer and |L| = 3
+#define LIGHT_X -1
+#define LIGHT_Y -2
+#define LIGHT_Z 2
+
+// Hatching by row parity for faces turned away from the light, towards it, and in between
+static const uint8_t shades[3][2] = {{0xAA, 0x55}, {0xAA, 0x00}, {0x00, 0x00}};
+
+// First quadrant of sin() in 64 steps
+static const int16_t sines[65] = {
+    0,     402,   804,   1205,  1606,  2006,  2404,  2801,  3196,  3590,  3981,  4370,  4756,
+    5139,  5520,  5897,  6270,  6639,  7005,  7366,  7723,  8076,  8423,  8765,  9102,  9434,
+    9760,  10080, 10394, 10702, 11003, 11297, 11585, 11866, 12140, 12406, 12665, 12916, 13160,
+    13395, 13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978, 15137, 15286, 15426, 15557,
+    15679, 15791, 15893, 15986, 16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379, 16384,
+};
+
+struct vertex {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+};
+
+// Rows drawn to by the previous frame, all of them before the first one
+static struct crystal_rect drawn = {0, 0, CRYSTAL_WIDTH, CRYSTAL_HEIGHT};
+
+static int32_t sin_q14(uint16_t angle) {
+    uint16_t phase = angle & 0x3FFF;
+
+    if (angle & 0x4000) {
+        phase = 0x4000 - phase;
+    }
+
+    uint8_t index = phase >> 8;
+    int32_t value = sines[index];
+    if (index < 64) {
+        value += ((sines[index + 1] - sines[index]) * (phase & 0xFF)) >> 8;
+    }
+
+    return angle & 0x8000 ? -value : value;
+}
+
+static void transform(uint16_t angle, struct vertex v[VERTEX_COUNT]) {
+    // Only the ring spins; the apexes sit on the axis
+    v[VERTEX_TOP] = (struct vertex){0, -TOP_HEIGHT, 0};
+    v[VERTEX_BOTTOM] = (struct vertex){0, BOTTOM_HEIGHT, 0};
+    for (uint8_t i = 0; i < SIDES; i++) {
+        uint16_t a = angle + i * (TURN / SIDES);
+
+        v[VERTEX_RING + i] = (struct vertex){
+            (RADIUS * sin_q14(a + TURN / 4)) >> Q14, 0, (RADIUS * sin_q14(a)) >> Q14};
+    }
+
+    for (uint8_t i = 0; i < VERTEX_COUNT; i++) {
+        int32_t y = v[i].y, z = v[i].z;
+
+        v[i].x += CENTER_X;
+        v[i].y = CENTER_Y + ((y * TILT_COS + z * TILT_SIN) >> Q14);
+        v[i].z = (z * TILT_COS - y * TILT_SIN) >> Q14;
+    }
+}
+
+// Corners of face i, counterclockwise on screen when it faces the viewer
+static void face_vertices(uint8_t face, uint8_t corners[3]) {
+    uint8_t i = face % SIDES, next = (i + 1) % SIDES;
+
+    if (face < SIDES) {
+        corners[0] = VERTEX_TOP;
+        corners[1] = VERTEX_RING + i;
+        corners[2] = VERTEX_RING + next;
+    } else {
+        corners[0] = VERTEX_BOTTOM;
+        corners[1] = VERTEX_RING + next;
+        corners[2] = VERTEX_RING + i;
+    }
+}
+
+// Index into shades[] from the face normal, or -1 for a face turned away from the viewer
+static int8_t face_shade(const struct vertex *a, const struct vertex *b, const struct vertex *c) {
+    int32_t ux = b->x - a->x, uy = b->y - a->y, uz = b->z - a->z;
+    int32_t vx = c->x - a->x, vy = c->y - a->y, vz = c->z - a->z;
+    int32_t nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+
+    if (nz <= 0) {
+        return -1;
+    }
+
+    // Lit beyond 60 degrees from the light, where dot > |n| * |L| / 2
+    int64_t dot = nx * LIGHT_X + ny * LIGHT_Y + nz * LIGHT_Z;
+    if (dot <= 0) {
+        return 0;
+    }
+
+    int64_t norm = (int64_t)nx * nx + (int64_t)ny * ny + (int64_t)nz * nz;
+    return 4 * dot * dot > 9 * norm ? 2 : 1;
+}
+
+/**
+ * Rasterization
+ **/
+
+static inline int32_t floor_px(int32_t v) { return v >> 4; }
+
+// Index of the first pixel whose center lies at or beyond v
+static inline int32_t ceil_center(int32_t v) { return (v - SUBPIXEL / 2 + SUBPIXEL - 1) >> 4; }
+
+static void fill_span(uint8_t *row, int32_t x0, int32_t x1, uint8_t pattern) {
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (x1 > CRYSTAL_WIDTH) {
+        x1 = CRYSTAL_WIDTH;
+    }
+    if (x0 >= x1 || pattern == 0) {
+        return;
+    }
+
+    uint8_t first = x0 / 8, last = (x1 - 1) / 8;
+    uint8_t head = 0xFF >> (x0 % 8), tail = 0xFF << (7 - (x1 - 1) % 8);
+
+    if (first == last) {
+        row[first] |= pattern & head & tail;
+        return;
+    }
+
+    row[first] |= pattern & head;
+    for (uint8_t i = first + 1; i < last; i++) {
+        row[i] |= pattern;
+    }
+    row[last] |= pattern & tail;
+}
+
+// Position on edge a-b at height y, all in subpixels
+static inline int32_t edge_x(const struct vertex *a, const struct vertex *b, int32_t y) {
+    return a->x + (b->x - a->x) * (y - a->y) / (b->y - a->y);
+}
+
+// Hatches the pixels whose centers lie inside the triangle
+static void fill_triangle(uint8_t *pixels, const struct vertex *a, const struct vertex *b,
+                          const struct vertex *c, uint8_t shade) {
+    const struct vertex *t;
+
+    // Sort by height, so a-c is the long edge, and a-b and b-c the short ones
+    if (b->y < a->y) {
+        t = a, a = b, b = t;
+    }
+    if (c->y < b->y) {
+        t = b, b = c, c = t;
+    }
+    if (b->y < a->y) {
+        t = a, a = b, b = t;
+    }
+
+    int32_t top = ceil_center(a->y), bottom = ceil_center(c->y);
+    if (top < 0) {
+        top = 0;
+    }
+    if (bottom > CRYSTAL_HEIGHT) {
+        bottom = CRYSTAL_HEIGHT;
+    }
+
+    for (int32_t y = top; y < bottom; y++) {
+        int32_t center = y * SUBPIXEL + SUBPIXEL / 2;
+        int32_t x0 = edge_x(a, c, center);
+        int32_t x1 = center < b->y ? edge_x(a, b, center) : edge_x(b, c, center);
+
+        if (x1 < x0) {
+            int32_t x = x0;
+            x0 = x1;
+            x1 = x;
+        }
+
+        fill_span(pixels + y * STRIDE, ceil_center(x0), ceil_center(x1), shades[shade][y & 1]);
+    }
+}
+
+static inline void set_pixel(uint8_t *pixels, int32_t x, int32_t y) {
+    if (x >= 0 && x < CRYSTAL_WIDTH && y >= 0 && y < CRYSTAL_HEIGHT) {
+        pixels[y * STRIDE + x / 8] |= 0x80 >> (x % 8);
+    }
+}
+
+static void draw_edge(uint8_t *pixels, const struct vertex *a, const struct vertex *b) {
+    int32_t x0 = floor_px(a->x), y0 = floor_px(a->y);
+    int32_t x1 = floor_px(b->x), y1 = floor_px(b->y);
+    int32_t dx = x1 > x0 ? x1 - x0 : x0 - x1, sx = x1 > x0 ? 1 : -1;
+    int32_t dy = y1 > y0 ? y0 - y1 : y1 - y0, sy = y1 > y0 ? 1 : -1;
+    int32_t err = dx + dy;
+
+    // Bresenham, with dy negated
+    while (true) {
+        set_pixel(pixels, x0, y0);
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+
+        int32_t e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+static void bounds(const struct vertex v[VERTEX_COUNT], struct crystal_rect *rect) {
+    int32_t x0 = v[0].x, x1 = v[0].x, y0 = v[0].y, y1 = v[0].y;
+
+    for (uint8_t i = 1; i < VERTEX_COUNT; i++) {
+        x0 = v[i].x < x0 ? v[i].x : x0;
+        x1 = v[i].x > x1 ? v[i].x : x1;
+        y0 = v[i].y < y0 ? v[i].y : y0;
+        y1 = v[i].y > y1 ? v[i].y : y1;
+    }
+
+    // Edge pixels are the ones the vertices fall in
+    x0 = floor_px(x0) < 0 ? 0 : floor_px(x0);
+    y0 = floor_px(y0) < 0 ? 0 : floor_px(y0);
+    x1 = floor_px(x1) + 1 > CRYSTAL_WIDTH ? CRYSTAL_WIDTH : floor_px(x1) + 1;
+    y1 = floor_px(y1) + 1 > CRYSTAL_HEIGHT ? CRYSTAL_HEIGHT : floor_px(y1) + 1;
+
+    *rect = (struct crystal_rect){x0, y0, x1 - x0, y1 - y0};
+}
+
+static void merge(struct crystal_rect *rect, const struct crystal_rect *other) {
+    uint8_t x0 = rect->x < other->x ? rect->x : other->x;
+    uint8_t y0 = rect->y < other->y ? rect->y : other->y;
+    uint8_t x1 = rect->x + rect->w > other->x + other->w ? rect->x + rect->w : other->x + other->w;
+    uint8_t y1 = rect->y + rect->h > other->y + other->h ? rect->y + rect->h : other->y + other->h;
+
+    *rect = (struct crystal_rect){x0, y0, x1 - x0, y1 - y0};
+}
+
+void crystal_render(uint8_t *pixels, uint16_t index, uint16_t count,
+                    struct crystal_rect *changed) {
+    struct vertex v[VERTEX_COUNT];
+    struct crystal_rect rect;
+    // Edges between the apexes and ring vertex i, then ring vertices i and i + 1
+    uint16_t edges = 0;
+
+    transform((uint32_t)index * (TURN / SIDES) / count, v);
+    bounds(v, &rect);
+
+    memset(pixels + drawn.y * STRIDE, 0, drawn.h * STRIDE);
+
+    for (uint8_t face = 0; face < FACE_COUNT; face++) {
+        uint8_t corners[3];
+
+        face_vertices(face, corners);
+        int8_t shade = face_shade(&v[corners[0]], &v[corners[1]], &v[corners[2]]);
+        if (shade < 0) {
+            continue;
+        }
+
+        fill_triangle(pixels, &v[corners[0]], &v[corners[1]], &v[corners[2]], shade);
+
+        uint8_t i = face % SIDES, next = (i + 1) % SIDES, half = face < SIDES ? 0 : SIDES;
+        edges |= (1 << (half + i)) | (1 << (half + next)) | (1 << (2 * SIDES + i));
+    }
+
+    // Faces are convex, so the edges of the visible ones are exactly the visible edges
+    for (uint8_t i = 0; i < SIDES; i++) {
+        if (edges & (1 << i)) {
+            draw_edge(pixels, &v[VERTEX_TOP], &v[VERTEX_RING + i]);
+        }
+        if (edges & (1 << (SIDES + i))) {
+            draw_edge(pixels, &v[VERTEX_BOTTOM], &v[VERTEX_RING + i]);
+        }
+        if (edges & (1 << (2 * SIDES + i))) {
+            draw_edge(pixels, &v[VERTEX_RING + i], &v[VERTEX_RING + (i + 1) % SIDES]);
+        }
+    }
+
+    *changed = rect;
+    merge(changed, &drawn);
+    drawn = rect;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Procedural crystal
+ *
+ * With CONFIG_NICE_VIEW_GEM_ANIMATION_PROCEDURAL the peripheral crystal is rasterized from a
+ * small fixed-point model instead of stored frames: a bipyramid spun about an axis tilted 15
+ * degrees towards the viewer, with hidden faces culled, the others hatched by how much they face
+ * the light, and their edges drawn on top. Flash cost is the same for any frame count.
+ *
+ * A frame must render within CRYSTAL_BUDGET_US on the 64 MHz Cortex-M4 of the nRF52840, which
+ * the animation figure of CONFIG_NICE_VIEW_GEM_RENDER_STATS measures on the keyboard.
+ * tests/crystal_bench.c only bounds the host time, see there.
+ **/
+
+#define CRYSTAL_WIDTH 69
+#define CRYSTAL_HEIGHT 68
+#define CRYSTAL_BUDGET_US 1000
+
+struct crystal_rect {
+    uint8_t x;
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+};
+
+// Renders frame index of count, which make up one period of the spin, into a packed MSB-first
+// CRYSTAL_WIDTH x CRYSTAL_HEIGHT buffer with set bits for the foreground. Only rows the previous
+// call drew to are cleared, and the rectangle changed since then is returned in changed.
+void crystal_render(uint8_t *pixels, uint16_t index, uint16_t count,
+                    struct crystal_rect *changed);
@@ -0,0 +1,62 @@
+#include <zephyr/kernel.h>
+#include "digits.h"
+#include "../assets/custom_fonts.h"
+
+// Sprites for '0' to '9', then '%'
+#define SPRITE_PERCENT 10
+#define SPRITE_COUNT 11
+
+// One byte per row of a text rectangle, leftmost pixel in the top bit
+static uint8_t sprites[SPRITE_COUNT][TEXT_HEIGHT];
+
+static void render_sprite(uint8_t sprite[], uint32_t letter) {
+    const lv_font_t *font = &pixel_operator_mono;
+    const uint8_t *bitmap = lv_font_get_glyph_bitmap(font, letter);
+    lv_font_glyph_dsc_t glyph;
+
+    lv_font_get_glyph_dsc(font, &glyph, letter, 0);
+
+    // Same placement as the label renderer: glyph boxes sit on the baseline, below the line top
+    int16_t top = font->line_height - font->base_line - glyph.box_h - glyph.ofs_y;
+
+    __ASSERT(glyph.bpp == 1 && glyph.adv_w == DIGIT_CELL_WIDTH && glyph.ofs_x >= 0 &&
+                 glyph.ofs_x + glyph.box_w <= DIGIT_CELL_WIDTH && top >= 0 &&
+                 top + glyph.box_h <= TEXT_HEIGHT,
+             "Glyph %c does not fit a digit cell", letter);
+
+    // Font bitmaps are packed bit by bit, without padding at the end of rows
+    for (uint16_t y = 0; y < glyph.box_h; y++) {
+        for (uint16_t x = 0; x < glyph.box_w; x++) {
+            uint32_t bit = y * glyph.box_w + x;
+            if (bitmap[bit / 8] & (0x80 >> (bit % 8))) {
+                sprite[top + y] |= 0x80 >> (glyph.ofs_x + x);
+            }
+        }
+    }
+}
+
+void init_digit_sprites(void) {
+    for (uint8_t i = 0; i < 10; i++) {
+        render_sprite(sprites[i], '0' + i);
+    }
+    render_sprite(sprites[SPRITE_PERCENT], '%');
+}
+
+void draw_number(canvas_t *canvas, uint16_t x, uint16_t y, uint16_t w, uint16_t value,
+                 bool percent) {
+    // Cells are laid out from the right edge, where right-aligned monospace text ends
+    x += w;
+
+    if (percent) {
+        x -= DIGIT_CELL_WIDTH;
+        canvas_draw_bits(canvas, x, y, DIGIT_CELL_WIDTH, TEXT_HEIGHT, sprites[SPRITE_PERCENT], 1,
+                         LVGL_FOREGROUND);
+    }
+
+    do {
+        x -= DIGIT_CELL_WIDTH;
+        canvas_draw_bits(canvas, x, y, DIGIT_CELL_WIDTH, TEXT_HEIGHT, sprites[value % 10], 1,
+                         LVGL_FOREGROUND);
+        value /= 10;
+    } while (value > 0);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <lvgl.h>
+#include "util.h"
+
+// Advance of every pixel_operator_mono glyph, so a sprite row fits one byte
+#define DIGIT_CELL_WIDTH 8
+
+// Renders the digit and percent sprites from pixel_operator_mono, once at startup
+void init_digit_sprites(void);
+// Draws value right-aligned in the text rectangle, optionally followed by a percent sign. Gives
+// the same pixels as canvas_draw_text, without formatting or glyph lookups.
+void draw_number(canvas_t *canvas, uint16_t x, uint16_t y, uint16_t w, uint16_t value,
+                 bool percent);
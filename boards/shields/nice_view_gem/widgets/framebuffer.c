@@ -0,0 +1,147 @@
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+#include "framebuffer.h"
+#include "render_stats.h"
+#include "rotate.h"
+#include "util.h"
+
+#define LINE_BYTES PACKED_STRIDE(PANEL_WIDTH)
+
+static const struct device *const display = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+
+// The whole panel in the driver's pixel format, so changed lines are written without conversion
+static struct {
+    uint8_t lines[PANEL_LINES][LINE_BYTES];
+    bool dirty[PANEL_LINES];
+    bool msb_first;
+    // Bit value of a white pixel: 1 for MONO01, 0 for MONO10
+    bool white_bit;
+    bool ready;
+    bool shown;
+} fb;
+
+static inline void put_pixel(uint8_t *line, uint16_t x, bool white) {
+    uint8_t mask = fb.msb_first ? BIT(7 - x % 8) : BIT(x % 8);
+
+    if (white == fb.white_bit) {
+        line[x / 8] |= mask;
+    } else {
+        line[x / 8] &= ~mask;
+    }
+}
+
+int framebuffer_init(void) {
+    struct display_capabilities caps;
+
+    if (!device_is_ready(display)) {
+        LOG_ERR("Display device not ready");
+        return -ENODEV;
+    }
+
+    display_get_capabilities(display, &caps);
+    if (caps.x_resolution != PANEL_WIDTH || caps.y_resolution != PANEL_LINES ||
+        (caps.screen_info & SCREEN_INFO_MONO_VTILED) ||
+        (caps.current_pixel_format != PIXEL_FORMAT_MONO01 &&
+         caps.current_pixel_format != PIXEL_FORMAT_MONO10)) {
+        LOG_ERR("Direct framebuffer needs a %ux%u line-addressed monochrome panel", PANEL_WIDTH,
+                PANEL_LINES);
+        return -ENOTSUP;
+    }
+
+    fb.msb_first = caps.screen_info & SCREEN_INFO_MONO_MSB_FIRST;
+    fb.white_bit = caps.current_pixel_format == PIXEL_FORMAT_MONO01;
+    fb.ready = true;
+    framebuffer_clear();
+
+    return 0;
+}
+
+void framebuffer_clear(void) {
+    if (!fb.ready) {
+        return;
+    }
+
+    memset(fb.lines, lv_color_to1(LVGL_BACKGROUND) == fb.white_bit ? 0xFF : 0x00,
+           sizeof(fb.lines));
+    memset(fb.dirty, true, sizeof(fb.dirty));
+}
+
+void framebuffer_blit(const uint8_t *src, uint16_t stride, int16_t x, int16_t y, uint16_t w,
+                      uint16_t h, const uint8_t damage[], bool white) {
+    // Clip to the panel once, so the copy loop only deals with visible pixels
+    uint16_t first_col = MAX(-x, 0);
+    uint16_t end_col = CLAMP(PANEL_WIDTH - x, 0, w);
+    uint16_t first_row = MAX(-y, 0);
+    uint16_t end_row = CLAMP(PANEL_LINES - y, 0, h);
+
+    if (!fb.ready) {
+        return;
+    }
+
+    for (uint16_t row = first_row; row < end_row; row++) {
+        const uint8_t *bits = src + row * stride;
+        uint8_t *line = fb.lines[y + row];
+        uint8_t before[LINE_BYTES];
+
+        if (damage != NULL && damage[row] == 0) {
+            continue;
+        }
+
+        memcpy(before, line, LINE_BYTES);
+        for (uint16_t col = first_col; col < end_col; col++) {
+            bool set = bits[col / 8] & (0x80 >> (col % 8));
+            put_pixel(line, x + col, set == white);
+        }
+
+        fb.dirty[y + row] |= memcmp(before, line, LINE_BYTES) != 0;
+    }
+}
+
+uint16_t framebuffer_flush(void) {
+    struct display_buffer_descriptor desc = {.width = PANEL_WIDTH, .pitch = PANEL_WIDTH};
+    uint16_t written = 0;
+
+    if (!fb.ready) {
+        return 0;
+    }
+
+    if (!fb.shown) {
+        // LVGL still refreshes its empty screen once after it is loaded. Let that happen now
+        // instead of over the first frame, then write the whole panel.
+        lv_refr_now(NULL);
+        memset(fb.dirty, true, sizeof(fb.dirty));
+        fb.shown = true;
+    }
+
+    for (uint16_t y = 0; y < PANEL_LINES;) {
+        if (!fb.dirty[y]) {
+            y++;
+            continue;
+        }
+
+        uint16_t start = y;
+        while (y < PANEL_LINES && fb.dirty[y]) {
+            fb.dirty[y++] = false;
+        }
+
+        desc.height = y - start;
+        desc.buf_size = desc.height * LINE_BYTES;
+        int err = display_write(display, 0, start, &desc, fb.lines[start]);
+        if (err < 0) {
+            LOG_WRN("Failed to write panel lines %u to %u (%d)", start, y - 1, err);
+        }
+        written += desc.height;
+    }
+
+    if (written > 0) {
+        RENDER_STATS_FLUSH(written * PANEL_WIDTH);
+    }
+
+    return written;
+}
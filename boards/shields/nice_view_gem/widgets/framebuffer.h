@@ -0,0 +1,19 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+#include "layout.h"
+
+// The panel in its native orientation: lines of SCREEN_HEIGHT pixels, SCREEN_WIDTH lines
+#define PANEL_WIDTH SCREEN_HEIGHT
+#define PANEL_LINES SCREEN_WIDTH
+
+int framebuffer_init(void);
+// Fills the panel with the background color, so regions can be placed again after a rotation
+void framebuffer_clear(void);
+// Copies a packed MSB-first bitmap w by h to panel position (x, y), clipped to the panel. Set
+// bits are white if white is true and black otherwise. Rows whose damage entry is 0 are skipped
+// when damage is given. Lines that change are written by the next flush.
+void framebuffer_blit(const uint8_t *src, uint16_t stride, int16_t x, int16_t y, uint16_t w,
+                      uint16_t h, const uint8_t damage[], bool white);
+// Writes each run of changed lines with display_write() and returns the number of lines written
+uint16_t framebuffer_flush(void);
@@ -0,0 +1,184 @@
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/activity.h>
+#include <zmk/battery.h>
+#include <zmk/display.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
+#include <zmk/events/battery_state_changed.h>
+#include <zmk/events/position_state_changed.h>
+#include <zmk/events/split_peripheral_status_changed.h>
+#include <zmk/events/usb_conn_state_changed.h>
+#include <zmk/split/bluetooth/peripheral.h>
+#include <zmk/usb.h>
+
+#include "animation.h"
+#include "battery.h"
+#include "governor.h"
+#include "output.h"
+
+static struct {
+    struct k_work_delayable step;
+    struct k_work_delayable report;
+    bool active;
+    bool connected;
+    bool low_battery;
+    uint32_t period;
+} governor;
+
+// Written by the key press listener, read on the display work queue
+static atomic_t last_keypress;
+static atomic_t throttled;
+
+/**
+ * Rate selection
+ **/
+
+// Runs full rate after a key press, halves the rate every slowdown interval without one, and
+// freezes on the current frame while idle, disconnected or low on battery
+static void governor_update(void) {
+    uint32_t period = 0;
+    int32_t next_step = -1;
+
+    if (governor.active && governor.connected && !governor.low_battery) {
+        uint32_t quiet = k_uptime_get_32() - (uint32_t)atomic_get(&last_keypress);
+        uint32_t step = MIN(quiet / CONFIG_NICE_VIEW_GEM_ANIMATION_SLOWDOWN_MS,
+                            CONFIG_NICE_VIEW_GEM_ANIMATION_SLOWDOWN_STEPS);
+
+        period = ANIMATION_PERIOD << step;
+        if (step < CONFIG_NICE_VIEW_GEM_ANIMATION_SLOWDOWN_STEPS) {
+            next_step = (step + 1) * CONFIG_NICE_VIEW_GEM_ANIMATION_SLOWDOWN_MS - quiet;
+        }
+    }
+
+    atomic_set(&throttled, period != ANIMATION_PERIOD);
+
+    if (period != governor.period) {
+        LOG_DBG("Animation period %u ms", period);
+        governor.period = period;
+        animation_set_period(period);
+    }
+
+    if (next_step >= 0) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), &governor.step, K_MSEC(next_step));
+    } else {
+        k_work_cancel_delayable(&governor.step);
+    }
+}
+
+static void governor_step(struct k_work *work) { governor_update(); }
+
+static void governor_report(struct k_work *work) {
+    LOG_INF("Animation: %u frames in the last hour", animation_take_frame_count());
+    k_work_schedule_for_queue(zmk_display_work_q(), &governor.report, K_HOURS(1));
+}
+
+/**
+ * Key presses
+ **/
+
+static int governor_keypress_listener(const zmk_event_t *eh) {
+    const struct zmk_position_state_changed *ev = as_zmk_position_state_changed(eh);
+
+    if (ev == NULL || !ev->state) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    atomic_set(&last_keypress, k_uptime_get_32());
+
+    // Already at full rate in the common case, so typing costs no display work
+    if (atomic_get(&throttled)) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), &governor.step, K_NO_WAIT);
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(animation_governor, governor_keypress_listener);
+ZMK_SUBSCRIPTION(animation_governor, zmk_position_state_changed);
+
+/**
+ * Activity status
+ **/
+
+static void activity_status_update_cb(struct activity_status_state state) {
+    governor.active = state.state == ZMK_ACTIVITY_ACTIVE;
+    governor_update();
+}
+
+static struct activity_status_state activity_status_get_state(const zmk_event_t *eh) {
+    return (struct activity_status_state){.state = zmk_activity_get_state()};
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(governor_activity_status, struct activity_status_state,
+                            activity_status_update_cb, activity_status_get_state)
+ZMK_SUBSCRIPTION(governor_activity_status, zmk_activity_state_changed);
+
+/**
+ * Battery status
+ **/
+
+static void battery_status_update_cb(struct battery_status_state state) {
+    governor.low_battery = state.level < CONFIG_NICE_VIEW_GEM_ANIMATION_MIN_BATTERY;
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+    governor.low_battery &= !state.usb_present;
+#endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
+    governor_update();
+}
+
+static struct battery_status_state battery_status_get_state(const zmk_event_t *eh) {
+    const struct zmk_battery_state_changed *ev = as_zmk_battery_state_changed(eh);
+
+    return (struct battery_status_state){
+        .level = (ev != NULL) ? ev->state_of_charge : zmk_battery_state_of_charge(),
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+        .usb_present = zmk_usb_is_powered(),
+#endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
+    };
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(governor_battery_status, struct battery_status_state,
+                            battery_status_update_cb, battery_status_get_state)
+ZMK_SUBSCRIPTION(governor_battery_status, zmk_battery_state_changed);
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+ZMK_SUBSCRIPTION(governor_battery_status, zmk_usb_conn_state_changed);
+#endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
+
+/**
+ * Peripheral status
+ **/
+
+static void connection_status_update_cb(struct peripheral_status_state state) {
+    governor.connected = state.connected;
+    governor_update();
+}
+
+static struct peripheral_status_state connection_status_get_state(const zmk_event_t *eh) {
+    return (struct peripheral_status_state){.connected = zmk_split_bt_peripheral_is_connected()};
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(governor_connection_status, struct peripheral_status_state,
+                            connection_status_update_cb, connection_status_get_state)
+ZMK_SUBSCRIPTION(governor_connection_status, zmk_split_peripheral_status_changed);
+
+/**
+ * Initialization
+ **/
+
+void animation_governor_init(void) {
+    k_work_init_delayable(&governor.step, governor_step);
+    k_work_init_delayable(&governor.report, governor_report);
+
+    // Start as if a key was just pressed; the listeners below settle the actual rate
+    governor.period = ANIMATION_PERIOD;
+    atomic_set(&last_keypress, k_uptime_get_32());
+
+    governor_activity_status_init();
+    governor_battery_status_init();
+    governor_connection_status_init();
+
+    k_work_schedule_for_queue(zmk_display_work_q(), &governor.report, K_HOURS(1));
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Adapts the crystal animation rate to typing activity, split connection and battery level
+void animation_governor_init(void);
@@ -1,19 +1,110 @@
 #include <zephyr/kernel.h>
+#include <zmk/keymap.h>
 #include "layer.h"
-#include "../assets/custom_fonts.h"
 
-void draw_layer_status(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_CENTER);
+// Rows a layer name can draw to: the layer rectangle and the descenders of "Layer N" below it
+#define NAME_Y RECT_Y(LAYOUT_LAYER)
+#define NAME_H (RECT_H(LAYOUT_LAYER) + TEXT_DESCENT)
+// Bytes of a packed row that columns [x, x + w) fall into
+#define SPAN_BYTES(x, w) (PACKED_STRIDE((x) + (w)) - (x) / 8)
+// After rotation the name rows become region buffer columns, at either end of the region
+// depending on the orientation
+#define NAME_BYTES                                                                                 \
+    MAX(SPAN_BYTES(NAME_Y, NAME_H), SPAN_BYTES(REGION_BOTTOM_HEIGHT - NAME_Y - NAME_H, NAME_H))
+#define NAME_TEXT_SIZE 10
+// Layers past the first CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE render the bottom region in full
+#define NAME_CACHE_SIZE MIN(ZMK_KEYMAP_LAYERS_LEN, CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE)
 
-    char text[10] = {};
+// A layer name as last drawn into the bottom region, kept as the bytes of each region buffer row
+// that hold it. The label prefix it was drawn from tells when a renamed layer needs drawing again.
+struct layer_name {
+    bool valid;
+    bool labeled;
+    char label[NAME_TEXT_SIZE];
+    uint8_t rows[SCREEN_WIDTH * NAME_BYTES];
+};
 
-    if (state->layer_label == NULL) {
-        sprintf(text, "Layer %i", state->layer_index);
+static struct layer_name names[NAME_CACHE_SIZE];
+
+BUILD_ASSERT(NAME_Y + NAME_H <= REGION_BOTTOM_HEIGHT, "Layer name descenders off region");
+
+static void draw_name(canvas_t *canvas, uint8_t index, const char *label) {
+    char text[NAME_TEXT_SIZE] = {};
+
+    if (label == NULL) {
+        sprintf(text, "Layer %i", index);
     } else {
-        strncpy(text, state->layer_label, 9);
+        strncpy(text, label, NAME_TEXT_SIZE - 1);
         to_uppercase(text);
     }
 
-    lv_canvas_draw_text(canvas, 0, 146 + BUFFER_OFFSET_BOTTOM, 68, &label_dsc, text);
-}
\ No newline at end of file
+    canvas_draw_text(canvas, RECT_X(LAYOUT_LAYER), RECT_Y(LAYOUT_LAYER), RECT_W(LAYOUT_LAYER),
+                     LV_TEXT_ALIGN_CENTER, text);
+}
+
+static bool name_matches(const struct layer_name *name, const char *label) {
+    if (!name->valid || name->labeled != (label != NULL)) {
+        return false;
+    }
+
+    return label == NULL || strncmp(name->label, label, NAME_TEXT_SIZE - 1) == 0;
+}
+
+// First region buffer column of the name rows in the current orientation
+static uint16_t name_column(void) { return region_column(NAME_Y, NAME_H, REGION_BOTTOM_HEIGHT); }
+
+// Reads the rows of the drawing surface that become the cached region buffer bytes back, and
+// rotates just those the way rotate_canvas() does. Rows past the region edge are left clear; they
+// fall outside the name rows and blit_columns() masks them off.
+static void cache_name(canvas_t *scratch, uint8_t index, const char *label) {
+    uint16_t first = name_column() / 8;
+    uint16_t bytes = SPAN_BYTES(name_column(), NAME_H);
+    // Surface rows that rotate onto region buffer columns [first * 8, (first + bytes) * 8)
+    int16_t y = region_column(first * 8, bytes * 8, REGION_BOTTOM_HEIGHT);
+    int16_t top = MAX(y, 0);
+    int16_t bottom = MIN(y + bytes * 8, REGION_BOTTOM_HEIGHT);
+    uint8_t packed[PACKED_SIZE(SCREEN_WIDTH, NAME_BYTES * 8)] = {0};
+    struct layer_name *name = &names[index];
+
+    __ASSERT(canvas_height(scratch) == REGION_BOTTOM_HEIGHT, "Scratch is not the bottom region");
+    canvas_pack_rows(scratch, top, bottom - top, &packed[(top - y) * PACKED_STRIDE(SCREEN_WIDTH)]);
+    // Rows are stored as densely as blit_columns() reads them
+    rotate_to_panel(packed, PACKED_STRIDE(SCREEN_WIDTH), SCREEN_WIDTH, bytes * 8, name->rows,
+                    bytes, NULL);
+
+    name->valid = true;
+    name->labeled = label != NULL;
+    if (label != NULL) {
+        strncpy(name->label, label, NAME_TEXT_SIZE - 1);
+    }
+}
+
+void init_layer_names(canvas_t *scratch, const uint8_t bgbuf[]) {
+    resize_scratch(scratch, REGION_BOTTOM_HEIGHT);
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(names); i++) {
+        const char *label = zmk_keymap_layer_name(i);
+
+        load_background(scratch, bgbuf);
+        draw_name(scratch, i, label);
+        cache_name(scratch, i, label);
+    }
+}
+
+void draw_layer_status(canvas_t *canvas, const struct status_state *state) {
+    draw_name(canvas, state->layer_index, state->layer_label);
+
+    if (state->layer_index < ARRAY_SIZE(names) &&
+        !name_matches(&names[state->layer_index], state->layer_label)) {
+        cache_name(canvas, state->layer_index, state->layer_label);
+    }
+}
+
+int blit_layer_status(region_t *region, uint8_t cbuf[], const struct status_state *state) {
+    if (state->layer_index >= ARRAY_SIZE(names) ||
+        !name_matches(&names[state->layer_index], state->layer_label)) {
+        return -ENOENT;
+    }
+
+    return blit_columns(region, cbuf, names[state->layer_index].rows, name_column(), NAME_H);
+}
@@ -8,4 +8,13 @@ struct layer_status_state {
     const char *label;
 };
 
-void draw_layer_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
+// Draws the names of the first CONFIG_NICE_VIEW_GEM_LAYER_NAME_CACHE keymap layers over the
+// bottom region background, so that changes to those layers can skip drawing and rotation.
+// Called again when the orientation changes.
+void init_layer_names(canvas_t *scratch, const uint8_t bgbuf[]);
+// Also caches the layer's name from the drawing surface, which must hold the bottom region, when
+// the cached one no longer reads the same
+void draw_layer_status(canvas_t *canvas, const struct status_state *state);
+// Copies the cached layer name straight into the bottom region buffer and returns the number of
+// lines that changed, or -ENOENT if the name is not cached as it currently reads
+int blit_layer_status(region_t *region, uint8_t cbuf[], const struct status_state *state);
\ No newline at end of file
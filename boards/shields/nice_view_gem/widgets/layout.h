@@ -0,0 +1,147 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/**
+ * Regions
+ *
+ * Each region is drawn unrotated on a canvas SCREEN_WIDTH pixels wide and REGION_*_HEIGHT rows
+ * tall, then rotated onto the panel. At 270 degrees its rows become panel columns starting at
+ * REGION_*_OFFSET and its columns become panel lines, shifted by REGION_*_ALIGN_Y. At 90 degrees
+ * the whole panel image is turned upside down, see orientation.h.
+ **/
+
+#define SCREEN_WIDTH 68
+#define SCREEN_HEIGHT 160
+
+#define REGION_TOP_OFFSET 0
+#define REGION_TOP_HEIGHT 30
+#define REGION_TOP_ALIGN_Y -2
+
+#define REGION_MIDDLE_OFFSET 44
+#define REGION_MIDDLE_HEIGHT 68
+#define REGION_MIDDLE_ALIGN_Y 0
+
+#define REGION_BOTTOM_OFFSET 129
+#define REGION_BOTTOM_HEIGHT 31
+#define REGION_BOTTOM_ALIGN_Y -2
+
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+#define SCRATCH_HEIGHT MAX(REGION_TOP_HEIGHT, MAX(REGION_MIDDLE_HEIGHT, REGION_BOTTOM_HEIGHT))
+#else
+#define SCRATCH_HEIGHT REGION_TOP_HEIGHT
+#endif
+
+/**
+ * Widget rectangles
+ *
+ * Region-relative x, y, width, height. Text rectangles span from the label origin to the bottom
+ * of uppercase glyphs and digits in pixel_operator_mono.
+ **/
+
+#define TEXT_HEIGHT 11
+// How far lowercase descenders reach below a text rectangle
+#define TEXT_DESCENT 2
+
+// Top
+#define LAYOUT_OUTPUT_LABEL 0, 1, 25, TEXT_HEIGHT
+#define LAYOUT_OUTPUT_ICON 43, 0, 24, 15
+// Icons drawn over LAYOUT_OUTPUT_ICON, at the size of their images
+#define LAYOUT_OUTPUT_ICON_USB 45, 2, 20, 11
+#define LAYOUT_OUTPUT_ICON_BT_UNBONDED 44, 0, 22, 15
+#define LAYOUT_OUTPUT_ICON_BT 49, 0, 12, 15
+#define LAYOUT_BATTERY_LABEL 0, 19, 25, TEXT_HEIGHT
+#define LAYOUT_BATTERY_VALUE 26, 19, 42, TEXT_HEIGHT
+#define LAYOUT_BATTERY_CHARGING_VALUE 26, 19, 35, TEXT_HEIGHT
+#define LAYOUT_BATTERY_BOLT 62, 21, 5, 9
+
+// Middle
+#define LAYOUT_WPM_GAUGE 16, 0, 33, 10
+#define LAYOUT_WPM_GRAPH 1, 21, 67, 33
+#define LAYOUT_WPM_LABEL 3, 57, 25, TEXT_HEIGHT
+#define LAYOUT_WPM_VALUE 28, 57, 38, TEXT_HEIGHT
+
+// Needle pivot and radii; the needle sweeps 90 degrees upwards over the gauge
+#define WPM_NEEDLE_X 33
+#define WPM_NEEDLE_Y 23
+#define WPM_NEEDLE_INNER 13
+#define WPM_NEEDLE_OUTER 25.45585f
+
+// Bottom
+#define LAYOUT_PROFILES 18, 2, 31, 3
+#define LAYOUT_PROFILE_SPACING 7
+#define LAYOUT_LAYER 0, 17, SCREEN_WIDTH, TEXT_HEIGHT
+
+// Peripheral crystal animation, drawn in panel orientation at a margin from the bottom right at
+// 270 degrees
+#define ANIMATION_WIDTH 69
+#define ANIMATION_HEIGHT 68
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ANIMATION_PROCEDURAL)
+#define ANIMATION_FRAMES CONFIG_NICE_VIEW_GEM_ANIMATION_FRAMES
+#else
+#define ANIMATION_FRAMES 16
+#endif
+#define ANIMATION_RIGHT 36
+#define ANIMATION_BOTTOM 2
+#define ANIMATION_X (SCREEN_HEIGHT - ANIMATION_WIDTH - ANIMATION_RIGHT)
+#define ANIMATION_Y (SCREEN_WIDTH - ANIMATION_HEIGHT - ANIMATION_BOTTOM)
+
+#define _RECT_X(x, y, w, h) (x)
+#define _RECT_Y(x, y, w, h) (y)
+#define _RECT_W(x, y, w, h) (w)
+#define _RECT_H(x, y, w, h) (h)
+#define RECT_X(...) _RECT_X(__VA_ARGS__)
+#define RECT_Y(...) _RECT_Y(__VA_ARGS__)
+#define RECT_W(...) _RECT_W(__VA_ARGS__)
+#define RECT_H(...) _RECT_H(__VA_ARGS__)
+
+#define RECT_IN_REGION(rect, height)                                                               \
+    (RECT_X(rect) >= 0 && RECT_Y(rect) >= 0 && RECT_X(rect) + RECT_W(rect) <= SCREEN_WIDTH &&     \
+     RECT_Y(rect) + RECT_H(rect) <= (height))
+#define RECT_INSIDE(inner, outer)                                                                  \
+    (RECT_X(inner) >= RECT_X(outer) && RECT_Y(inner) >= RECT_Y(outer) &&                           \
+     RECT_X(inner) + RECT_W(inner) <= RECT_X(outer) + RECT_W(outer) &&                             \
+     RECT_Y(inner) + RECT_H(inner) <= RECT_Y(outer) + RECT_H(outer))
+#define RECTS_DISJOINT(a, b)                                                                       \
+    (RECT_X(a) + RECT_W(a) <= RECT_X(b) || RECT_X(b) + RECT_W(b) <= RECT_X(a) ||                   \
+     RECT_Y(a) + RECT_H(a) <= RECT_Y(b) || RECT_Y(b) + RECT_H(b) <= RECT_Y(a))
+
+BUILD_ASSERT(REGION_TOP_OFFSET + REGION_TOP_HEIGHT <= REGION_MIDDLE_OFFSET, "Regions overlap");
+BUILD_ASSERT(REGION_MIDDLE_OFFSET + REGION_MIDDLE_HEIGHT <= REGION_BOTTOM_OFFSET,
+             "Regions overlap");
+BUILD_ASSERT(REGION_BOTTOM_OFFSET + REGION_BOTTOM_HEIGHT <= SCREEN_HEIGHT, "Region off screen");
+
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_OUTPUT_LABEL, REGION_TOP_HEIGHT), "Output label off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_OUTPUT_ICON, REGION_TOP_HEIGHT), "Output icon off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_BATTERY_LABEL, REGION_TOP_HEIGHT), "Battery label off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_BATTERY_VALUE, REGION_TOP_HEIGHT), "Battery value off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_BATTERY_BOLT, REGION_TOP_HEIGHT), "Battery bolt off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_OUTPUT_ICON_USB, REGION_TOP_HEIGHT), "USB icon off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_OUTPUT_ICON_BT_UNBONDED, REGION_TOP_HEIGHT),
+             "BT icon off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_OUTPUT_ICON_BT, REGION_TOP_HEIGHT), "BT icon off region");
+BUILD_ASSERT(RECT_INSIDE(LAYOUT_OUTPUT_ICON_USB, LAYOUT_OUTPUT_ICON), "USB icon off its box");
+BUILD_ASSERT(RECT_INSIDE(LAYOUT_OUTPUT_ICON_BT_UNBONDED, LAYOUT_OUTPUT_ICON),
+             "BT icon off its box");
+BUILD_ASSERT(RECT_INSIDE(LAYOUT_OUTPUT_ICON_BT, LAYOUT_OUTPUT_ICON), "BT icon off its box");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_OUTPUT_LABEL, LAYOUT_OUTPUT_ICON), "Output widgets overlap");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_OUTPUT_ICON, LAYOUT_BATTERY_VALUE), "Top widgets overlap");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_BATTERY_LABEL, LAYOUT_BATTERY_VALUE), "Battery widgets overlap");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_BATTERY_CHARGING_VALUE, LAYOUT_BATTERY_BOLT),
+             "Battery widgets overlap");
+
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_WPM_GAUGE, REGION_MIDDLE_HEIGHT), "Gauge off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_WPM_GRAPH, REGION_MIDDLE_HEIGHT), "Graph off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_WPM_LABEL, REGION_MIDDLE_HEIGHT), "WPM label off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_WPM_VALUE, REGION_MIDDLE_HEIGHT), "WPM value off region");
+// The needle's lowest point is its inner end at 45 degrees on either side
+BUILD_ASSERT(WPM_NEEDLE_Y - WPM_NEEDLE_INNER * 707 / 1000 < RECT_Y(LAYOUT_WPM_GRAPH),
+             "Needle overlaps graph");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_WPM_GAUGE, LAYOUT_WPM_GRAPH), "WPM widgets overlap");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_WPM_GRAPH, LAYOUT_WPM_LABEL), "WPM widgets overlap");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_WPM_GRAPH, LAYOUT_WPM_VALUE), "WPM widgets overlap");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_WPM_LABEL, LAYOUT_WPM_VALUE), "WPM widgets overlap");
+
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_PROFILES, REGION_BOTTOM_HEIGHT), "Profiles off region");
+BUILD_ASSERT(RECT_IN_REGION(LAYOUT_LAYER, REGION_BOTTOM_HEIGHT), "Layer off region");
+BUILD_ASSERT(RECTS_DISJOINT(LAYOUT_PROFILES, LAYOUT_LAYER), "Bottom widgets overlap");
@@ -0,0 +1,187 @@
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/shell/shell.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#include "layout.h"
+#include "orientation.h"
+#include "rotate.h"
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_ORIENTATION_90)
+#define ORIENTATION_DEFAULT ORIENTATION_90
+#else
+#define ORIENTATION_DEFAULT ORIENTATION_270
+#endif
+
+// Written by the settings handler, applied by the display work queue between frames
+static atomic_t requested = ATOMIC_INIT(ORIENTATION_DEFAULT);
+static enum orientation current = ORIENTATION_DEFAULT;
+static void (*on_change)(void);
+
+static void orientation_changed(struct k_work *work) {
+    if (on_change != NULL) {
+        on_change();
+    }
+}
+
+static K_WORK_DEFINE(orientation_work, orientation_changed);
+
+void orientation_init(void (*changed)(void)) {
+    on_change = changed;
+    current = atomic_get(&requested);
+}
+
+bool orientation_update(void) {
+    enum orientation next = atomic_get(&requested);
+
+    if (next == current) {
+        return false;
+    }
+
+    LOG_INF("Status screen orientation %d degrees", next);
+    current = next;
+    return true;
+}
+
+enum orientation display_orientation(void) { return current; }
+
+static bool supported(unsigned long angle) {
+    return angle == ORIENTATION_90 || angle == ORIENTATION_270;
+}
+
+// Requests an angle from any thread
+static void request(enum orientation angle) {
+    atomic_set(&requested, angle);
+    // Before the screen exists, its initialization picks the angle up instead
+    if (zmk_display_is_initialized()) {
+        k_work_submit_to_queue(zmk_display_work_q(), &orientation_work);
+    }
+}
+
+/**
+ * Placement
+ **/
+
+// At 90 degrees the panel image is the 270 degree one turned upside down, so regions keep their
+// REGION_*_ALIGN_Y margins at the opposite panel edges
+void region_origin(int16_t offset, int16_t align_y, uint16_t height, int16_t *x, int16_t *y) {
+    switch (current) {
+    case ORIENTATION_90:
+        *x = SCREEN_HEIGHT - offset - height;
+        *y = -align_y;
+        break;
+    case ORIENTATION_270:
+    default:
+        *x = offset;
+        *y = align_y;
+        break;
+    }
+}
+
+uint16_t region_column(uint16_t y, uint16_t h, uint16_t height) {
+    switch (current) {
+    case ORIENTATION_90:
+        return height - y - h;
+    case ORIENTATION_270:
+    default:
+        return y;
+    }
+}
+
+void rotate_to_panel(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, uint8_t *dst,
+                     uint16_t dst_stride, uint8_t *damage) {
+    switch (current) {
+    case ORIENTATION_90:
+        rotate_1bpp_90(src, src_stride, w, h, dst, dst_stride, damage);
+        break;
+    case ORIENTATION_270:
+    default:
+        rotate_1bpp_270(src, src_stride, w, h, dst, dst_stride, damage);
+        break;
+    }
+}
+
+/**
+ * Settings
+ **/
+
+#if IS_ENABLED(CONFIG_SETTINGS)
+static int orientation_set(const char *name, size_t len, settings_read_cb read_cb, void *cb_arg) {
+    uint16_t angle;
+    int rc;
+
+    if (!settings_name_steq(name, "orientation", NULL)) {
+        return -ENOENT;
+    }
+
+    if (len != sizeof(angle)) {
+        return -EINVAL;
+    }
+
+    rc = read_cb(cb_arg, &angle, sizeof(angle));
+    if (rc < 0) {
+        return rc;
+    }
+
+    if (!supported(angle)) {
+        LOG_WRN("Unsupported status screen orientation %u, only 90 and 270 are", angle);
+        return -EINVAL;
+    }
+
+    request(angle);
+
+    return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(nice_view_gem, "nice_view_gem", NULL, orientation_set, NULL, NULL);
+#endif
+
+/**
+ * Shell
+ **/
+
+#if IS_ENABLED(CONFIG_SHELL)
+
+// Shows the orientation, or switches to an angle and saves it to the settings entry, which only
+// reaches the handler above when settings are next loaded
+static int cmd_orientation(const struct shell *sh, size_t argc, char **argv) {
+    unsigned long angle;
+    int err = 0;
+
+    if (argc < 2) {
+        shell_print(sh, "%d degrees", (int)atomic_get(&requested));
+        return 0;
+    }
+
+    angle = shell_strtoul(argv[1], 10, &err);
+    if (err != 0 || !supported(angle)) {
+        shell_error(sh, "Only 90 and 270 degrees are supported");
+        return -EINVAL;
+    }
+
+    request(angle);
+
+#if IS_ENABLED(CONFIG_SETTINGS)
+    uint16_t value = angle;
+
+    err = settings_save_one("nice_view_gem/orientation", &value, sizeof(value));
+    if (err < 0) {
+        shell_error(sh, "Failed to save the orientation (%d)", err);
+        return err;
+    }
+#endif
+
+    return 0;
+}
+
+// The gem command; other files add their subcommands with SHELL_SUBCMD_ADD((gem), ...)
+SHELL_SUBCMD_SET_CREATE(gem_cmds, (gem));
+SHELL_SUBCMD_ADD((gem), orientation, NULL, "Show or set the status screen orientation: 90|270",
+                 cmd_orientation, 1, 1);
+SHELL_CMD_REGISTER(gem, &gem_cmds, "nice!view gem status screen", NULL);
+
+#endif
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+/**
+ * Orientation
+ *
+ * The layout is portrait and the panel landscape, so regions are turned clockwise by 270 degrees
+ * onto the panel, or by 90 degrees for a panel mounted the other way round. Each angle has its
+ * own rotation kernel and placement below. A landscape layout would be needed for 0 and 180.
+ *
+ * CONFIG_NICE_VIEW_GEM_ORIENTATION_* picks the angle, and the nice_view_gem/orientation settings
+ * entry, a uint16_t angle, overrides it at runtime. The gem orientation shell command switches
+ * the angle and saves that entry.
+ **/
+
+enum orientation {
+    ORIENTATION_90 = 90,
+    ORIENTATION_270 = 270,
+};
+
+// Registers the display work queue callback that redraws the screen after the setting changes
+void orientation_init(void (*changed)(void));
+// Switches to the requested orientation on the display work queue, returning true if it changed
+bool orientation_update(void);
+enum orientation display_orientation(void);
+
+// Panel position of a region buffer for a region at REGION_*_OFFSET and REGION_*_ALIGN_Y
+void region_origin(int16_t offset, int16_t align_y, uint16_t height, int16_t *x, int16_t *y);
+// Region buffer column that region rows [y, y + h) start at, in a region height rows tall
+uint16_t region_column(uint16_t y, uint16_t h, uint16_t height);
+// Rotates a packed region w x h into its region buffer with the kernel for the orientation
+void rotate_to_panel(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, uint8_t *dst,
+                     uint16_t dst_stride, uint8_t *damage);
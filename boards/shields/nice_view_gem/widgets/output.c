@@ -1,51 +1,42 @@
 #include <zephyr/kernel.h>
 #include "output.h"
-#include "../assets/custom_fonts.h"
+#include "rle.h"
 
-LV_IMG_DECLARE(bt_no_signal);
-LV_IMG_DECLARE(bt_unbonded);
-LV_IMG_DECLARE(bt);
-LV_IMG_DECLARE(usb);
+RLE_IMAGE_DECLARE(bt_no_signal);
+RLE_IMAGE_DECLARE(bt_unbonded);
+RLE_IMAGE_DECLARE(bt);
+RLE_IMAGE_DECLARE(usb);
 
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
-static void draw_usb_connected(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 45, 2, &usb, &img_dsc);
+static void draw_usb_connected(canvas_t *canvas) {
+    canvas_draw_rle(canvas, RECT_X(LAYOUT_OUTPUT_ICON_USB), RECT_Y(LAYOUT_OUTPUT_ICON_USB),
+                    &usb);
 }
 
-static void draw_ble_unbonded(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 44, 0, &bt_unbonded, &img_dsc);
+static void draw_ble_unbonded(canvas_t *canvas) {
+    canvas_draw_rle(canvas, RECT_X(LAYOUT_OUTPUT_ICON_BT_UNBONDED),
+                    RECT_Y(LAYOUT_OUTPUT_ICON_BT_UNBONDED), &bt_unbonded);
 }
 #endif
 
-static void draw_ble_disconnected(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 49, 0, &bt_no_signal, &img_dsc);
+static void draw_ble_disconnected(canvas_t *canvas) {
+    canvas_draw_rle(canvas, RECT_X(LAYOUT_OUTPUT_ICON_BT), RECT_Y(LAYOUT_OUTPUT_ICON_BT),
+                    &bt_no_signal);
 }
 
-static void draw_ble_connected(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    lv_canvas_draw_img(canvas, 49, 0, &bt, &img_dsc);
+static void draw_ble_connected(canvas_t *canvas) {
+    canvas_draw_rle(canvas, RECT_X(LAYOUT_OUTPUT_ICON_BT), RECT_Y(LAYOUT_OUTPUT_ICON_BT), &bt);
 }
 
-void draw_output_status(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    lv_canvas_draw_text(canvas, 0, 1, 25, &label_dsc, "SIG");
+void draw_output_background(canvas_t *canvas) {
+    canvas_draw_text(canvas, RECT_X(LAYOUT_OUTPUT_LABEL), RECT_Y(LAYOUT_OUTPUT_LABEL),
+                     RECT_W(LAYOUT_OUTPUT_LABEL), LV_TEXT_ALIGN_LEFT, "SIG");
 
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-    lv_canvas_draw_rect(canvas, 43, 0, 24, 15, &rect_white_dsc);
+    canvas_fill_rect(canvas, RECT_X(LAYOUT_OUTPUT_ICON), RECT_Y(LAYOUT_OUTPUT_ICON),
+                     RECT_W(LAYOUT_OUTPUT_ICON), RECT_H(LAYOUT_OUTPUT_ICON), LVGL_FOREGROUND);
+}
 
+void draw_output_status(canvas_t *canvas, const struct status_state *state) {
 #if !IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
     switch (state->selected_endpoint.transport) {
     case ZMK_TRANSPORT_USB:
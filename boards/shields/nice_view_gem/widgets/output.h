@@ -17,4 +17,5 @@ struct peripheral_status_state {
 };
 #endif
 
-void draw_output_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
+void draw_output_background(canvas_t *canvas);
+void draw_output_status(canvas_t *canvas, const struct status_state *state);
\ No newline at end of file
@@ -1,31 +1,23 @@
 #include <zephyr/kernel.h>
 #include "profile.h"
+#include "rle.h"
 
-LV_IMG_DECLARE(profiles);
+RLE_IMAGE_DECLARE(profiles);
 
-static void draw_inactive_profiles(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-
-    // 原代码: lv_canvas_draw_img(canvas, 18, 129 + BUFFER_OFFSET_BOTTOM, &profiles, &img_dsc);
-    // 原始 y 坐标: 129 + BUFFER_OFFSET_BOTTOM
-    // 修改后 y 坐标: 131 + BUFFER_OFFSET_BOTTOM (下移 2 像素)
-    lv_canvas_draw_img(canvas, 18, 131 + BUFFER_OFFSET_BOTTOM, &profiles, &img_dsc);
+static void draw_inactive_profiles(canvas_t *canvas) {
+    canvas_draw_rle(canvas, RECT_X(LAYOUT_PROFILES), RECT_Y(LAYOUT_PROFILES), &profiles);
 }
 
-static void draw_active_profile(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-
-    int offset = state->active_profile_index * 7;
+static void draw_active_profile(canvas_t *canvas, const struct status_state *state) {
+    // The active marker is a square as tall as the profile dots
+    int offset = state->active_profile_index * LAYOUT_PROFILE_SPACING;
 
-    // 原代码: lv_canvas_draw_rect(canvas, 18 + offset, 129 + BUFFER_OFFSET_BOTTOM, 3, 3, &rect_white_dsc);
-    // 修改后 y 坐标: 131 + BUFFER_OFFSET_BOTTOM (下移 2 像素)
-    // x 坐标保持不变，因为它只与 profile index 相关
-    lv_canvas_draw_rect(canvas, 18 + offset, 131 + BUFFER_OFFSET_BOTTOM, 3, 3, &rect_white_dsc);
+    canvas_fill_rect(canvas, RECT_X(LAYOUT_PROFILES) + offset, RECT_Y(LAYOUT_PROFILES),
+                     RECT_H(LAYOUT_PROFILES), RECT_H(LAYOUT_PROFILES), LVGL_FOREGROUND);
 }
 
-void draw_profile_status(lv_obj_t *canvas, const struct status_state *state) {
-    draw_inactive_profiles(canvas, state);
+void draw_profile_background(canvas_t *canvas) { draw_inactive_profiles(canvas); }
+
+void draw_profile_status(canvas_t *canvas, const struct status_state *state) {
     draw_active_profile(canvas, state);
 }
\ No newline at end of file
@@ -3,4 +3,5 @@
 #include <lvgl.h>
 #include "util.h"
 
-void draw_profile_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
+void draw_profile_background(canvas_t *canvas);
+void draw_profile_status(canvas_t *canvas, const struct status_state *state);
\ No newline at end of file
@@ -0,0 +1,273 @@
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <lvgl.h>
+#include <zmk/display.h>
+
+#include "render_stats.h"
+
+struct render_timing {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+};
+
+struct render_stats {
+    // Render durations in timer cycles
+    struct render_timing renders[RENDER_STAT_COUNT];
+    // Time from the first event of a frame until the panel was flushed, in microseconds
+    struct render_timing latency;
+    // The same, counted from the first layer change only
+    struct render_timing layer_latency;
+    uint32_t flushes;
+    uint32_t flushed_px;
+    // Status updates that reached the display work queue while the screen was frozen for idle
+    uint32_t idle_wakeups;
+    uint32_t idle_ms;
+};
+
+static const char *const stat_names[RENDER_STAT_COUNT] = {
+    [RENDER_STAT_TOP] = "top",
+    [RENDER_STAT_MIDDLE] = "middle",
+    [RENDER_STAT_BOTTOM] = "bottom",
+    [RENDER_STAT_LAYER] = "layer",
+    [RENDER_STAT_ROTATE] = "rotate",
+    [RENDER_STAT_ANIMATION] = "animation",
+};
+
+static struct k_spinlock lock;
+static struct render_stats stats;
+
+// Uptime of the first flush in milliseconds, kept across resets
+static uint32_t first_flush_ms;
+
+// Event to flush tracking, only touched from the display work queue
+struct latency_probe {
+    bool event_pending;
+    bool awaiting_flush;
+    int64_t event_ticks;
+};
+
+static struct latency_probe event_probe;
+static struct latency_probe layer_probe;
+static bool frame_damaged;
+
+// Idle period tracking, guarded by the lock
+static bool idle;
+static int64_t idle_start;
+
+static void timing_add(struct render_timing *timing, uint32_t value) {
+    if (timing->count == 0 || value < timing->min) {
+        timing->min = value;
+    }
+    if (value > timing->max) {
+        timing->max = value;
+    }
+    timing->total += value;
+    timing->count++;
+}
+
+static uint32_t timing_avg(const struct render_timing *timing) {
+    return timing->count > 0 ? timing->total / timing->count : 0;
+}
+
+void render_stats_record(enum render_stat stat, timing_t start) {
+    timing_t end = timing_counter_get();
+    uint32_t cycles = (uint32_t)timing_cycles_get(&start, &end);
+
+    K_SPINLOCK(&lock) { timing_add(&stats.renders[stat], cycles); }
+}
+
+void render_stats_damage(uint16_t rows) { frame_damaged |= rows > 0; }
+
+static void probe_event(struct latency_probe *probe) {
+    if (!probe->event_pending) {
+        probe->event_pending = true;
+        probe->event_ticks = k_uptime_ticks();
+    }
+}
+
+void render_stats_event(void) { probe_event(&event_probe); }
+
+void render_stats_layer_event(void) { probe_event(&layer_probe); }
+
+static void probe_frame(struct latency_probe *probe) {
+    // A frame that changed no panel lines is never flushed, so its events have no latency
+    if (probe->event_pending && !frame_damaged) {
+        probe->event_pending = false;
+    }
+    probe->awaiting_flush = probe->event_pending;
+}
+
+void render_stats_frame(void) {
+    probe_frame(&event_probe);
+    probe_frame(&layer_probe);
+    frame_damaged = false;
+}
+
+void render_stats_idle(bool now_idle) {
+    int64_t now = k_uptime_get();
+
+    K_SPINLOCK(&lock) {
+        if (idle != now_idle) {
+            if (idle) {
+                stats.idle_ms += now - idle_start;
+            }
+            idle = now_idle;
+            idle_start = now;
+        }
+    }
+}
+
+void render_stats_wakeup(void) {
+    K_SPINLOCK(&lock) { stats.idle_wakeups += idle; }
+}
+
+// Called with the lock held
+static void probe_flush(struct latency_probe *probe, struct render_timing *latency) {
+    if (probe->awaiting_flush) {
+        timing_add(latency, k_ticks_to_us_floor32(k_uptime_ticks() - probe->event_ticks));
+        probe->awaiting_flush = false;
+        probe->event_pending = false;
+    }
+}
+
+void render_stats_flush(uint32_t px) {
+    K_SPINLOCK(&lock) {
+        if (first_flush_ms == 0) {
+            first_flush_ms = k_uptime_get_32();
+        }
+
+        stats.flushes++;
+        stats.flushed_px += px;
+        probe_flush(&event_probe, &stats.latency);
+        probe_flush(&layer_probe, &stats.layer_latency);
+    }
+}
+
+#if !IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+static void flush_monitor(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px) {
+    render_stats_flush(px);
+}
+#endif
+
+/**
+ * Reporting
+ **/
+
+static struct render_stats snapshot(bool reset) {
+    struct render_stats copy;
+
+    K_SPINLOCK(&lock) {
+        copy = stats;
+        if (idle) {
+            // Count the idle period so far, and start it afresh after a reset
+            int64_t now = k_uptime_get();
+            copy.idle_ms += now - idle_start;
+            if (reset) {
+                idle_start = now;
+            }
+        }
+        if (reset) {
+            memset(&stats, 0, sizeof(stats));
+        }
+    }
+
+    return copy;
+}
+
+#define STATS_RENDER_FMT "%s: %u renders, %u/%u/%u cycles min/avg/max (avg %u ns)"
+#define STATS_LATENCY_FMT "%s latency: %u frames, %u/%u/%u us min/avg/max"
+#define STATS_FLUSH_FMT "flushed: %u refreshes, %u px"
+#define STATS_BOOT_FMT "boot: first flush %u ms after boot"
+#define STATS_IDLE_FMT "idle: %u wakeups in %u s (%u per hour)"
+
+#define STATS_RENDER_ARGS(s, i)                                                                    \
+    stat_names[i], (s)->renders[i].count, (s)->renders[i].min, timing_avg(&(s)->renders[i]),      \
+        (s)->renders[i].max, (uint32_t)timing_cycles_to_ns(timing_avg(&(s)->renders[i]))
+#define STATS_LATENCY_ARGS(name, l) name, (l)->count, (l)->min, timing_avg(l), (l)->max
+#define STATS_FLUSH_ARGS(s) (s)->flushes, (s)->flushed_px
+#define STATS_IDLE_ARGS(s)                                                                         \
+    (s)->idle_wakeups, (s)->idle_ms / 1000,                                                        \
+        (s)->idle_ms > 0 ? (uint32_t)((uint64_t)(s)->idle_wakeups * 3600000 / (s)->idle_ms) : 0
+
+#if CONFIG_NICE_VIEW_GEM_STATS_LOG_INTERVAL > 0
+
+static void log_summary(struct k_work *work) {
+    struct render_stats s = snapshot(false);
+
+    for (int i = 0; i < RENDER_STAT_COUNT; i++) {
+        LOG_INF(STATS_RENDER_FMT, STATS_RENDER_ARGS(&s, i));
+    }
+    LOG_INF(STATS_LATENCY_FMT, STATS_LATENCY_ARGS("event", &s.latency));
+    LOG_INF(STATS_LATENCY_FMT, STATS_LATENCY_ARGS("layer", &s.layer_latency));
+    LOG_INF(STATS_FLUSH_FMT, STATS_FLUSH_ARGS(&s));
+    LOG_INF(STATS_BOOT_FMT, first_flush_ms);
+    LOG_INF(STATS_IDLE_FMT, STATS_IDLE_ARGS(&s));
+
+    k_work_schedule_for_queue(zmk_display_work_q(), k_work_delayable_from_work(work),
+                              K_SECONDS(CONFIG_NICE_VIEW_GEM_STATS_LOG_INTERVAL));
+}
+
+static K_WORK_DELAYABLE_DEFINE(log_work, log_summary);
+
+#endif
+
+#if IS_ENABLED(CONFIG_SHELL)
+
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv) {
+    struct render_stats s = snapshot(false);
+
+    for (int i = 0; i < RENDER_STAT_COUNT; i++) {
+        shell_print(sh, STATS_RENDER_FMT, STATS_RENDER_ARGS(&s, i));
+    }
+    shell_print(sh, STATS_LATENCY_FMT, STATS_LATENCY_ARGS("event", &s.latency));
+    shell_print(sh, STATS_LATENCY_FMT, STATS_LATENCY_ARGS("layer", &s.layer_latency));
+    shell_print(sh, STATS_FLUSH_FMT, STATS_FLUSH_ARGS(&s));
+    shell_print(sh, STATS_BOOT_FMT, first_flush_ms);
+    shell_print(sh, STATS_IDLE_FMT, STATS_IDLE_ARGS(&s));
+
+    return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv) {
+    snapshot(true);
+    shell_print(sh, "Render statistics cleared");
+
+    return 0;
+}
+
+// Subcommands of the gem command registered in orientation.c
+SHELL_SUBCMD_ADD((gem), stats, NULL, "Show render statistics", cmd_stats, 1, 0);
+SHELL_SUBCMD_ADD((gem), reset, NULL, "Clear render statistics", cmd_reset, 1, 0);
+
+#endif
+
+/**
+ * Initialization
+ **/
+
+void render_stats_init(void) {
+    timing_init();
+    timing_start();
+
+#if !IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    lv_disp_t *disp = lv_disp_get_default();
+
+    // Flushes are only observable through the LVGL refresh monitor; leave any existing one alone
+    if (disp != NULL && disp->driver->monitor_cb == NULL) {
+        disp->driver->monitor_cb = flush_monitor;
+    } else {
+        LOG_WRN("Display refresh monitor unavailable, flush latency will not be recorded");
+    }
+#endif
+
+#if CONFIG_NICE_VIEW_GEM_STATS_LOG_INTERVAL > 0
+    k_work_schedule_for_queue(zmk_display_work_q(), &log_work,
+                              K_SECONDS(CONFIG_NICE_VIEW_GEM_STATS_LOG_INTERVAL));
+#endif
+}
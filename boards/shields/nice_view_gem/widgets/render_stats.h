@@ -0,0 +1,61 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+
+enum render_stat {
+    RENDER_STAT_TOP,
+    RENDER_STAT_MIDDLE,
+    RENDER_STAT_BOTTOM,
+    RENDER_STAT_LAYER,
+    RENDER_STAT_ROTATE,
+    RENDER_STAT_ANIMATION,
+    RENDER_STAT_COUNT,
+};
+
+/**
+ * Render profiling
+ *
+ * With CONFIG_NICE_VIEW_GEM_RENDER_STATS disabled every macro below expands to nothing, so
+ * production builds carry neither the calls nor the timestamps.
+ **/
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_RENDER_STATS)
+
+#include <zephyr/timing/timing.h>
+
+void render_stats_init(void);
+void render_stats_record(enum render_stat stat, timing_t start);
+void render_stats_damage(uint16_t rows);
+void render_stats_event(void);
+void render_stats_layer_event(void);
+void render_stats_frame(void);
+void render_stats_idle(bool idle);
+void render_stats_wakeup(void);
+// Reports a panel flush; the LVGL backend reports them through the LVGL refresh monitor
+void render_stats_flush(uint32_t px);
+
+#define RENDER_STATS_INIT() render_stats_init()
+#define RENDER_STATS_START(name) timing_t name = timing_counter_get()
+#define RENDER_STATS_RECORD(stat, name) render_stats_record(stat, name)
+#define RENDER_STATS_DAMAGE(rows) render_stats_damage(rows)
+#define RENDER_STATS_EVENT() render_stats_event()
+#define RENDER_STATS_LAYER_EVENT() render_stats_layer_event()
+#define RENDER_STATS_FRAME() render_stats_frame()
+#define RENDER_STATS_IDLE(idle) render_stats_idle(idle)
+#define RENDER_STATS_WAKEUP() render_stats_wakeup()
+#define RENDER_STATS_FLUSH(px) render_stats_flush(px)
+
+#else
+
+#define RENDER_STATS_INIT()
+#define RENDER_STATS_START(name)
+#define RENDER_STATS_RECORD(stat, name)
+#define RENDER_STATS_DAMAGE(rows)
+#define RENDER_STATS_EVENT()
+#define RENDER_STATS_LAYER_EVENT()
+#define RENDER_STATS_FRAME()
+#define RENDER_STATS_IDLE(idle)
+#define RENDER_STATS_WAKEUP()
+#define RENDER_STATS_FLUSH(px)
+
+#endif
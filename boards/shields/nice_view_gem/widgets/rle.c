@@ -0,0 +1,60 @@
+#include <zephyr/kernel.h>
+#include "rle.h"
+#include "util.h"
+
+#define RLE_LITERAL_MAX 0x80
+
+void rle_decode(const uint8_t *data, uint8_t *dst, uint16_t size) {
+    uint8_t *end = dst + size;
+
+    while (dst < end) {
+        uint8_t control = *data++;
+
+        if (control < RLE_LITERAL_MAX) {
+            memcpy(dst, data, control + 1);
+            data += control + 1;
+            dst += control + 1;
+        } else {
+            memset(dst, 0, control - RLE_LITERAL_MAX + 1);
+            dst += control - RLE_LITERAL_MAX + 1;
+        }
+    }
+}
+
+void canvas_draw_rle(canvas_t *canvas, int16_t x, int16_t y, const struct rle_image *img) {
+    lv_color_t set = img->inverted ? LVGL_BACKGROUND : LVGL_FOREGROUND;
+    lv_color_t clear = img->inverted ? LVGL_FOREGROUND : LVGL_BACKGROUND;
+    uint16_t stride = PACKED_STRIDE(img->w);
+    uint16_t size = stride * img->h;
+    const uint8_t *data = img->data;
+
+    // Zero runs are left at the clear color, so only literal bytes are painted
+    canvas_fill_rect(canvas, x, y, img->w, img->h, clear);
+
+    if (img->raw) {
+        canvas_draw_bits(canvas, x, y, img->w, img->h, data, stride, set);
+        return;
+    }
+
+    for (uint16_t pos = 0; pos < size;) {
+        uint8_t control = *data++;
+
+        if (control >= RLE_LITERAL_MAX) {
+            pos += control - RLE_LITERAL_MAX + 1;
+            continue;
+        }
+
+        // Literal runs continue across rows, so paint them a row piece at a time
+        for (uint16_t len = control + 1; len > 0;) {
+            uint16_t row = pos / stride;
+            uint16_t col = pos % stride;
+            uint16_t bytes = MIN(len, stride - col);
+            uint16_t w = MIN(bytes * 8, img->w - col * 8);
+
+            canvas_draw_bits(canvas, x + col * 8, y + row, w, 1, data, bytes, set);
+            data += bytes;
+            pos += bytes;
+            len -= bytes;
+        }
+    }
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <zephyr/kernel.h>
+#include "canvas.h"
+#include "../assets/rle_image.h"
+
+// Decodes run-length data, coded like a struct rle_image that is not raw, until size bytes are
+// written to dst
+void rle_decode(const uint8_t *data, uint8_t *dst, uint16_t size);
+// Draws the image opaquely, painting raw rows or literal runs straight from the data
+void canvas_draw_rle(canvas_t *canvas, int16_t x, int16_t y, const struct rle_image *img);
@@ -0,0 +1,194 @@
+#include <zephyr/kernel.h>
+#include "rotate.h"
+
+/**
+ * Packing
+ **/
+
+void pack_1bpp(const lv_color_t *src, uint16_t w, uint16_t h, uint8_t *dst, uint16_t dst_stride) {
+    for (uint16_t y = 0; y < h; y++) {
+        const lv_color_t *px = src + y * w;
+        uint8_t *out = dst + y * dst_stride;
+        uint16_t x = 0;
+
+        for (; x + 8 <= w; x += 8, px += 8) {
+            *out++ = (lv_color_to1(px[0]) << 7) | (lv_color_to1(px[1]) << 6) |
+                     (lv_color_to1(px[2]) << 5) | (lv_color_to1(px[3]) << 4) |
+                     (lv_color_to1(px[4]) << 3) | (lv_color_to1(px[5]) << 2) |
+                     (lv_color_to1(px[6]) << 1) | lv_color_to1(px[7]);
+        }
+
+        if (x < w) {
+            uint8_t byte = 0;
+            for (uint8_t bit = 0; x < w; x++, bit++) {
+                byte |= lv_color_to1(*px++) << (7 - bit);
+            }
+            *out = byte;
+        }
+    }
+}
+
+void unpack_1bpp(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h,
+                 lv_color_t *dst) {
+    const lv_color_t on = lv_color_white();
+    const lv_color_t off = lv_color_black();
+
+    for (uint16_t y = 0; y < h; y++) {
+        const uint8_t *row = src + y * src_stride;
+        uint16_t x = 0;
+
+        for (; x + 8 <= w; x += 8, dst += 8) {
+            uint8_t byte = *row++;
+
+            // Backgrounds are mostly solid, so whole bytes of one color skip the bit tests
+            if (byte == 0x00 || byte == 0xFF) {
+                const lv_color_t color = byte ? on : off;
+                dst[0] = dst[1] = dst[2] = dst[3] = color;
+                dst[4] = dst[5] = dst[6] = dst[7] = color;
+                continue;
+            }
+
+            dst[0] = (byte & 0x80) ? on : off;
+            dst[1] = (byte & 0x40) ? on : off;
+            dst[2] = (byte & 0x20) ? on : off;
+            dst[3] = (byte & 0x10) ? on : off;
+            dst[4] = (byte & 0x08) ? on : off;
+            dst[5] = (byte & 0x04) ? on : off;
+            dst[6] = (byte & 0x02) ? on : off;
+            dst[7] = (byte & 0x01) ? on : off;
+        }
+
+        if (x < w) {
+            for (uint8_t byte = *row; x < w; x++, byte <<= 1) {
+                *dst++ = (byte & 0x80) ? on : off;
+            }
+        }
+    }
+}
+
+/**
+ * Rotation
+ **/
+
+// Transposes an 8x8 bit matrix held as eight MSB-first row bytes (Hacker's Delight, 7-3)
+static inline void transpose_8x8(uint8_t m[8]) {
+    uint32_t x = ((uint32_t)m[0] << 24) | ((uint32_t)m[1] << 16) | ((uint32_t)m[2] << 8) | m[3];
+    uint32_t y = ((uint32_t)m[4] << 24) | ((uint32_t)m[5] << 16) | ((uint32_t)m[6] << 8) | m[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    m[0] = x >> 24;
+    m[1] = x >> 16;
+    m[2] = x >> 8;
+    m[3] = x;
+    m[4] = y >> 24;
+    m[5] = y >> 16;
+    m[6] = y >> 8;
+    m[7] = y;
+}
+
+static inline uint8_t reverse_bits(uint8_t byte) {
+    byte = (byte & 0xF0) >> 4 | (byte & 0x0F) << 4;
+    byte = (byte & 0xCC) >> 2 | (byte & 0x33) << 2;
+    return (byte & 0xAA) >> 1 | (byte & 0x55) << 1;
+}
+
+// Rotates a packed w x h image 90 degrees clockwise into a packed h x w image, so that
+// dst(x, y) = src(y, h - 1 - x). The mirror of rotate_1bpp_270(): each 8x8 block gathers eight
+// source rows bottom up, so one transpose yields eight whole destination bytes, which land on
+// eight consecutive destination rows in order.
+//
+// damage accumulates changed destination rows as in rotate_1bpp_270().
+void rotate_1bpp_90(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, uint8_t *dst,
+                    uint16_t dst_stride, uint8_t *damage) {
+    uint8_t block[8];
+
+    for (uint16_t x0 = 0; x0 < h; x0 += 8) {
+        // Source rows h - 1 - x0 and up become destination columns x0 and on
+        const uint8_t *in = src + (h - 1 - x0) * src_stride;
+        uint16_t rows = MIN(h - x0, 8);
+
+        for (uint16_t y0 = 0; y0 < w; y0 += 8) {
+            for (uint8_t i = 0; i < 8; i++) {
+                block[i] = (i < rows) ? *(in - i * src_stride + (y0 >> 3)) : 0;
+            }
+
+            transpose_8x8(block);
+
+            uint16_t cols = MIN(w - y0, 8);
+            uint8_t *out = dst + y0 * dst_stride + (x0 >> 3);
+            for (uint8_t j = 0; j < cols; j++, out += dst_stride) {
+                if (damage != NULL) {
+                    damage[y0 + j] |= *out ^ block[j];
+                }
+                *out = block[j];
+            }
+        }
+    }
+}
+
+// Rotates a packed w x h image 180 degrees, so that dst(x, y) = src(w - 1 - x, h - 1 - y).
+// Reversing the bytes of a row and the bits of each byte moves its padding bits to the front,
+// so every destination byte is shifted back out of two reversed source bytes.
+void rotate_1bpp_180(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, uint8_t *dst,
+                     uint16_t dst_stride) {
+    uint16_t bytes = PACKED_STRIDE(w);
+    uint8_t pad = bytes * 8 - w;
+
+    for (uint16_t y = 0; y < h; y++) {
+        const uint8_t *in = src + (h - 1 - y) * src_stride + bytes - 1;
+        uint8_t *out = dst + y * dst_stride;
+
+        for (uint16_t i = 0; i < bytes; i++, in--) {
+            uint16_t pair = reverse_bits(in[0]) << 8 | (i + 1 < bytes ? reverse_bits(in[-1]) : 0);
+            out[i] = pair >> (8 - pad);
+        }
+    }
+}
+
+// Rotates a packed w x h image 270 degrees clockwise into a packed h x w image, so that
+// dst(x, y) = src(w - 1 - y, x). Works on 8x8 blocks: one transpose yields eight destination
+// bytes, which land on eight consecutive destination rows in reverse order.
+//
+// If damage is not NULL, damage[y] accumulates the XOR of old and new bytes of destination row y,
+// so a non-zero entry marks a row whose pixels changed.
+void rotate_1bpp_270(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, uint8_t *dst,
+                     uint16_t dst_stride, uint8_t *damage) {
+    uint8_t block[8];
+
+    for (uint16_t y0 = 0; y0 < h; y0 += 8) {
+        const uint8_t *in = src + y0 * src_stride;
+        uint16_t rows = MIN(h - y0, 8);
+
+        for (uint16_t x0 = 0; x0 < w; x0 += 8) {
+            for (uint8_t i = 0; i < 8; i++) {
+                block[i] = (i < rows) ? in[i * src_stride + (x0 >> 3)] : 0;
+            }
+
+            transpose_8x8(block);
+
+            uint16_t cols = MIN(w - x0, 8);
+            uint16_t row = w - 1 - x0;
+            uint8_t *out = dst + row * dst_stride + (y0 >> 3);
+            for (uint8_t j = 0; j < cols; j++, row--, out -= dst_stride) {
+                if (damage != NULL) {
+                    damage[row] |= *out ^ block[j];
+                }
+                *out = block[j];
+            }
+        }
+    }
+}
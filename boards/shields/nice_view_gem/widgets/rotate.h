@@ -0,0 +1,16 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Bytes per row of a packed, MSB-first 1bpp buffer
+#define PACKED_STRIDE(w) (((w) + 7) / 8)
+#define PACKED_SIZE(w, h) (PACKED_STRIDE(w) * (h))
+
+void pack_1bpp(const lv_color_t *src, uint16_t w, uint16_t h, uint8_t *dst, uint16_t dst_stride);
+void unpack_1bpp(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, lv_color_t *dst);
+void rotate_1bpp_90(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, uint8_t *dst,
+                    uint16_t dst_stride, uint8_t *damage);
+void rotate_1bpp_180(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, uint8_t *dst,
+                     uint16_t dst_stride);
+void rotate_1bpp_270(const uint8_t *src, uint16_t src_stride, uint16_t w, uint16_t h, uint8_t *dst,
+                     uint16_t dst_stride, uint8_t *damage);
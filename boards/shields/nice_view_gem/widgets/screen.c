@@ -4,6 +4,7 @@
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
 #include <zmk/events/battery_state_changed.h>
 #include <zmk/events/ble_active_profile_changed.h>
 #include <zmk/events/endpoint_changed.h>
@@ -19,51 +20,241 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/wpm.h>
 
 #include "battery.h"
+#include "digits.h"
+#include "framebuffer.h"
 #include "layer.h"
+#include "orientation.h"
 #include "output.h"
 #include "profile.h"
+#include "render_stats.h"
 #include "screen.h"
 #include "wpm.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
+static struct frame_scheduler frames;
+// Set while idle, read by the WPM listener in the event thread
+static atomic_t frozen;
+
+/**
+ * Change detection
+ **/
+
+static bool top_changed(const struct status_state *drawn, const struct status_state *state) {
+    if (drawn->battery != state->battery || drawn->charging != state->charging ||
+        drawn->selected_endpoint.transport != state->selected_endpoint.transport) {
+        return true;
+    }
+
+    // Profile flags only pick the icon when BLE is the selected transport
+    return state->selected_endpoint.transport == ZMK_TRANSPORT_BLE &&
+           (drawn->active_profile_connected != state->active_profile_connected ||
+            drawn->active_profile_bonded != state->active_profile_bonded);
+}
+
+static bool middle_changed(const struct status_state *drawn, const struct status_state *state) {
+    return drawn->wpm.version != state->wpm.version || wpm_shown(drawn) != wpm_shown(state);
+}
+
+static bool bottom_changed(const struct status_state *drawn, const struct status_state *state) {
+    if (drawn->active_profile_index != state->active_profile_index) {
+        return true;
+    }
+
+    if (drawn->layer_label == NULL || state->layer_label == NULL) {
+        return drawn->layer_label != state->layer_label ||
+               drawn->layer_index != state->layer_index;
+    }
+
+    return strcmp(drawn->layer_label, state->layer_label) != 0;
+}
 
 /**
  * Draw buffers
  **/
 
-static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
-    fill_background(canvas);
+static void draw_top(struct zmk_widget_screen *widget) {
+    canvas_t *canvas = widget->scratch;
+    const struct status_state *state = &widget->state;
+
+    if (!region_should_render(&widget->top, state, top_changed)) {
+        return;
+    }
+
+    RENDER_STATS_START(start);
+    resize_scratch(canvas, REGION_TOP_HEIGHT);
+    load_background(canvas, widget->bgbuf);
 
     // Draw widgets
     draw_output_status(canvas, state);
     draw_battery_status(canvas, state);
 
     // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    uint16_t rows = rotate_canvas(canvas, widget->top_region, widget->cbuf);
+    RENDER_STATS_RECORD(RENDER_STAT_TOP, start);
+    LOG_DBG("Render top: %u lines changed (%u rendered, %u skipped)", rows,
+            widget->top.rendered, widget->top.skipped);
 }
 
-static void draw_middle(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 1);
-    fill_background(canvas);
+static void draw_middle(struct zmk_widget_screen *widget) {
+    canvas_t *canvas = widget->scratch;
+    const struct status_state *state = &widget->state;
+
+    if (!region_should_render(&widget->middle, state, middle_changed)) {
+        return;
+    }
+
+    RENDER_STATS_START(start);
+    resize_scratch(canvas, REGION_MIDDLE_HEIGHT);
+    update_wpm_chart(canvas, &widget->chart, state);
+    load_background(canvas, widget->bgbuf2);
 
     // Draw widgets
-    draw_wpm_status(canvas, state);
+    draw_wpm_status(canvas, &widget->chart, state);
 
     // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    uint16_t rows = rotate_canvas(canvas, widget->middle_region, widget->cbuf2);
+    RENDER_STATS_RECORD(RENDER_STAT_MIDDLE, start);
+    LOG_DBG("Render middle: %u lines changed (%u rendered, %u skipped)", rows,
+            widget->middle.rendered, widget->middle.skipped);
 }
 
-static void draw_bottom(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 2);
-    fill_background(canvas);
+// A layer change alone only replaces the layer name, which is cached in display orientation
+static bool draw_layer_only(struct zmk_widget_screen *widget) {
+    RENDER_STATS_START(start);
+    int rows = blit_layer_status(widget->bottom_region, widget->cbuf3, &widget->state);
+
+    if (rows < 0) {
+        return false;
+    }
+
+    RENDER_STATS_RECORD(RENDER_STAT_LAYER, start);
+    LOG_DBG("Render layer: %d lines changed", rows);
+    return true;
+}
+
+static void draw_bottom(struct zmk_widget_screen *widget) {
+    canvas_t *canvas = widget->scratch;
+    const struct status_state *state = &widget->state;
+    bool same_profile = widget->bottom.valid &&
+                        widget->bottom.state.active_profile_index == state->active_profile_index;
+
+    if (!region_should_render(&widget->bottom, state, bottom_changed)) {
+        return;
+    }
+
+    if (same_profile && draw_layer_only(widget)) {
+        return;
+    }
+
+    RENDER_STATS_START(start);
+    resize_scratch(canvas, REGION_BOTTOM_HEIGHT);
+    load_background(canvas, widget->bgbuf3);
 
     // Draw widgets
     draw_profile_status(canvas, state);
     draw_layer_status(canvas, state);
 
     // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    uint16_t rows = rotate_canvas(canvas, widget->bottom_region, widget->cbuf3);
+    RENDER_STATS_RECORD(RENDER_STAT_BOTTOM, start);
+    LOG_DBG("Render bottom: %u lines changed (%u rendered, %u skipped)", rows,
+            widget->bottom.rendered, widget->bottom.skipped);
+}
+
+static void place_regions(struct zmk_widget_screen *widget) {
+    place_region(widget->top_region, widget->cbuf, REGION_TOP_OFFSET, REGION_TOP_ALIGN_Y);
+    place_region(widget->middle_region, widget->cbuf2, REGION_MIDDLE_OFFSET,
+                 REGION_MIDDLE_ALIGN_Y);
+    place_region(widget->bottom_region, widget->cbuf3, REGION_BOTTOM_OFFSET,
+                 REGION_BOTTOM_ALIGN_Y);
+}
+
+// Region buffers still hold the old orientation after moving, so every region renders in full
+// and the layer names are cached again
+static void change_orientation(struct zmk_widget_screen *widget) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    framebuffer_clear();
+#endif
+    place_regions(widget);
+    init_layer_names(widget->scratch, widget->bgbuf3);
+
+    widget->top.valid = false;
+    widget->middle.valid = false;
+    widget->bottom.valid = false;
+    widget->dirty |= REGION_TOP | REGION_MIDDLE | REGION_BOTTOM;
+}
+
+static void init_backgrounds(struct zmk_widget_screen *widget) {
+    canvas_t *canvas = widget->scratch;
+
+    resize_scratch(canvas, REGION_TOP_HEIGHT);
+    fill_background(canvas);
+    draw_output_background(canvas);
+    draw_battery_background(canvas);
+    save_background(canvas, widget->bgbuf);
+
+    resize_scratch(canvas, REGION_MIDDLE_HEIGHT);
+    fill_background(canvas);
+    draw_wpm_background(canvas);
+    save_background(canvas, widget->bgbuf2);
+
+    resize_scratch(canvas, REGION_BOTTOM_HEIGHT);
+    fill_background(canvas);
+    draw_profile_background(canvas);
+    save_background(canvas, widget->bgbuf3);
+}
+
+/**
+ * Frame scheduling
+ **/
+
+static void render_frame(struct k_work *work) {
+    struct zmk_widget_screen *widget;
+    bool rotated = orientation_update();
+
+    frame_scheduler_begin(&frames);
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        if (rotated) {
+            change_orientation(widget);
+        }
+
+        uint8_t dirty = widget->dirty;
+        widget->dirty = 0;
+
+        if (dirty & REGION_TOP) {
+            draw_top(widget);
+        }
+        if (dirty & REGION_MIDDLE) {
+            draw_middle(widget);
+        }
+        if (dirty & REGION_BOTTOM) {
+            draw_bottom(widget);
+        }
+    }
+
+    frame_scheduler_end(&frames);
+    RENDER_STATS_FRAME();
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    framebuffer_flush();
+#endif
+}
+
+static void mark_dirty(struct zmk_widget_screen *widget, uint8_t regions) {
+    RENDER_STATS_WAKEUP();
+    // Held updates are timed from their release instead
+    if (!frames.holding) {
+        RENDER_STATS_EVENT();
+    }
+    widget->dirty |= regions;
+    frame_scheduler_request(&frames);
+}
+
+static void orientation_changed(void) {
+    struct zmk_widget_screen *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        mark_dirty(widget, REGION_TOP | REGION_MIDDLE | REGION_BOTTOM);
+    }
 }
 
 /**
@@ -77,7 +268,7 @@ static void set_battery_status(struct zmk_widget_screen *widget,
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
     widget->state.battery = state.level;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    mark_dirty(widget, REGION_TOP);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -112,7 +303,10 @@ static void set_layer_status(struct zmk_widget_screen *widget, struct layer_stat
     widget->state.layer_index = state.index;
     widget->state.layer_label = state.label;
 
-    draw_bottom(widget->obj, widget->cbuf3, &widget->state);
+    if (!frames.holding) {
+        RENDER_STATS_LAYER_EVENT();
+    }
+    mark_dirty(widget, REGION_BOTTOM);
 }
 
 static void layer_status_update_cb(struct layer_status_state state) {
@@ -141,8 +335,7 @@ static void set_output_status(struct zmk_widget_screen *widget,
     widget->state.active_profile_connected = state->active_profile_connected;
     widget->state.active_profile_bonded = state->active_profile_bonded;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
-    draw_bottom(widget->obj, widget->cbuf3, &widget->state);
+    mark_dirty(widget, REGION_TOP | REGION_BOTTOM);
 }
 
 static void output_status_update_cb(struct output_status_state state) {
@@ -175,12 +368,10 @@ ZMK_SUBSCRIPTION(widget_output_status, zmk_ble_active_profile_changed);
  **/
 
 static void set_wpm_status(struct zmk_widget_screen *widget, struct wpm_status_state state) {
-    for (int i = 0; i < 9; i++) {
-        widget->state.wpm[i] = widget->state.wpm[i + 1];
-    }
-    widget->state.wpm[9] = state.wpm;
+    wpm_history_push(&widget->state.wpm, state.wpm);
+    widget->state.wpm_idle = false;
 
-    draw_middle(widget->obj, widget->cbuf2, &widget->state);
+    mark_dirty(widget, REGION_MIDDLE);
 }
 
 static void wpm_status_update_cb(struct wpm_status_state state) {
@@ -192,47 +383,118 @@ struct wpm_status_state wpm_status_get_state(const zmk_event_t *eh) {
     return (struct wpm_status_state){.wpm = zmk_wpm_get_state()};
 };
 
-ZMK_DISPLAY_WIDGET_LISTENER(widget_wpm_status, struct wpm_status_state, wpm_status_update_cb,
-                            wpm_status_get_state)
+static void wpm_status_refresh(struct k_work *work) {
+    // A refresh queued just before freezing would undo the settled WPM
+    if (!atomic_get(&frozen)) {
+        wpm_status_update_cb(wpm_status_get_state(NULL));
+    }
+}
+
+static K_WORK_DEFINE(wpm_status_work, wpm_status_refresh);
+
+// Unlike the other widget listeners, WPM events are dropped in the event thread while frozen, so
+// the decay ticks after typing stops never wake the display work queue
+static int wpm_status_listener(const zmk_event_t *eh) {
+    if (zmk_display_is_initialized() && !atomic_get(&frozen)) {
+        k_work_submit_to_queue(zmk_display_work_q(), &wpm_status_work);
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+static void widget_wpm_status_init(void) { wpm_status_refresh(NULL); }
+
+ZMK_LISTENER(widget_wpm_status, wpm_status_listener);
 ZMK_SUBSCRIPTION(widget_wpm_status, zmk_wpm_state_changed);
 
+/**
+ * Activity status
+ **/
+
+// Leaves the panel with a settled image and does no render work until activity resumes. The
+// memory LCD keeps its image without refreshes, and every region buffer and last rendered state
+// stays in RAM, so waking re-renders only regions whose state changed while idle.
+static void freeze_screen(void) {
+    struct zmk_widget_screen *widget;
+
+    atomic_set(&frozen, true);
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        // WPM events are dropped from here on, so the last sample would stay up while idle. The
+        // gauge settles at 0 instead, without adding a sample to the chart.
+        if (wpm_shown(&widget->state) != 0) {
+            widget->state.wpm_idle = true;
+            mark_dirty(widget, REGION_MIDDLE);
+        }
+    }
+
+    frame_scheduler_freeze(&frames);
+    RENDER_STATS_IDLE(true);
+}
+
+static void thaw_screen(void) {
+    atomic_set(&frozen, false);
+    RENDER_STATS_IDLE(false);
+
+    if (frame_scheduler_release(&frames)) {
+        RENDER_STATS_EVENT();
+    }
+}
+
+static void activity_status_update_cb(struct activity_status_state state) {
+    if (state.state == ZMK_ACTIVITY_ACTIVE) {
+        thaw_screen();
+    } else {
+        freeze_screen();
+    }
+}
+
+static struct activity_status_state activity_status_get_state(const zmk_event_t *eh) {
+    return (struct activity_status_state){.state = zmk_activity_get_state()};
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_activity_status, struct activity_status_state,
+                            activity_status_update_cb, activity_status_get_state)
+ZMK_SUBSCRIPTION(widget_activity_status, zmk_activity_state_changed);
+
 /**
  * Initialization
  **/
 
 int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    // Regions go straight to the panel framebuffer, with no LVGL objects behind them
+    widget->obj = NULL;
+    framebuffer_init();
+#else
     widget->obj = lv_obj_create(parent);
     // 设置屏幕部件的整体大小
     lv_obj_set_size(widget->obj, SCREEN_HEIGHT, SCREEN_WIDTH);
+#endif
+
+    // 区域位置见 layout.h 和 orientation.h
+    orientation_init(orientation_changed);
+    widget->top_region = create_region(widget->obj, widget->cbuf, REGION_TOP_HEIGHT);
+    widget->middle_region = create_region(widget->obj, widget->cbuf2, REGION_MIDDLE_HEIGHT);
+    widget->bottom_region = create_region(widget->obj, widget->cbuf3, REGION_BOTTOM_HEIGHT);
+    place_regions(widget);
+
+    wpm_history_init(&widget->state.wpm);
+
+    widget->scratch = create_scratch_canvas(widget->obj);
+    init_digit_sprites();
+    init_backgrounds(widget);
+    init_layer_names(widget->scratch, widget->bgbuf3);
 
-    // --- 顶部区域画布 ---
-    lv_obj_t *top = lv_canvas_create(widget->obj);
-    // 修改对齐方式为 BOTTOM_LEFT，以适应 270 度旋转后的内容方向
-    lv_obj_align(top, LV_ALIGN_BOTTOM_LEFT, 0, -2);
-    lv_canvas_set_buffer(top, widget->cbuf, BUFFER_SIZE, BUFFER_SIZE, LV_IMG_CF_TRUE_COLOR);
-
-    // --- 中部区域画布 ---
-    lv_obj_t *middle = lv_canvas_create(widget->obj);
-    // 修改对齐方式为 BOTTOM_LEFT
-    // 原来的 BUFFER_OFFSET_MIDDLE 是负数，用于向左偏移。
-    // 270度旋转后，为了保持相对位置，需要向右（正方向）偏移相同距离，所以取负号。
-    lv_obj_align(middle, LV_ALIGN_BOTTOM_LEFT, -BUFFER_OFFSET_MIDDLE, 0);
-    lv_canvas_set_buffer(middle, widget->cbuf2, BUFFER_SIZE, BUFFER_SIZE, LV_IMG_CF_TRUE_COLOR);
-
-    // --- 底部区域画布 ---
-    lv_obj_t *bottom = lv_canvas_create(widget->obj);
-    // 修改对齐方式为 BOTTOM_LEFT
-    // 原来的 BUFFER_OFFSET_BOTTOM 是负数，用于向左偏移更远。
-    // 270度旋转后，为了保持相对位置，需要向右（正方向）偏移相同距离，所以取负号。
-    lv_obj_align(bottom, LV_ALIGN_BOTTOM_LEFT, -BUFFER_OFFSET_BOTTOM, -2);
-    lv_canvas_set_buffer(bottom, widget->cbuf3, BUFFER_SIZE, BUFFER_SIZE, LV_IMG_CF_TRUE_COLOR);
-
-    // --- 事件监听器和列表管理 (保持不变) ---
+    // --- 事件监听器和列表管理 ---
+    frame_scheduler_init(&frames, render_frame);
+    RENDER_STATS_INIT();
     sys_slist_append(&widgets, &widget->node);
     widget_battery_status_init();
     widget_layer_status_init();
     widget_output_status_init();
     widget_wpm_status_init();
+    frame_scheduler_release(&frames);
+    widget_activity_status_init();
 
     return 0;
 }
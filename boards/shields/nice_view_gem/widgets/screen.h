@@ -3,14 +3,27 @@
 #include <lvgl.h>
 #include <zephyr/kernel.h>
 #include "util.h"
+#include "wpm.h"
 
 struct zmk_widget_screen {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[BUFFER_SIZE * BUFFER_SIZE];
-    lv_color_t cbuf2[BUFFER_SIZE * BUFFER_SIZE];
-    lv_color_t cbuf3[BUFFER_SIZE * BUFFER_SIZE];
+    canvas_t *scratch;
+    region_t *top_region;
+    region_t *middle_region;
+    region_t *bottom_region;
+    uint8_t cbuf[CANVAS_BUF_SIZE(REGION_TOP_HEIGHT)];
+    uint8_t cbuf2[CANVAS_BUF_SIZE(REGION_MIDDLE_HEIGHT)];
+    uint8_t cbuf3[CANVAS_BUF_SIZE(REGION_BOTTOM_HEIGHT)];
+    uint8_t bgbuf[BACKGROUND_BUF_SIZE(REGION_TOP_HEIGHT)];
+    uint8_t bgbuf2[BACKGROUND_BUF_SIZE(REGION_MIDDLE_HEIGHT)];
+    uint8_t bgbuf3[BACKGROUND_BUF_SIZE(REGION_BOTTOM_HEIGHT)];
     struct status_state state;
+    uint8_t dirty;
+    struct region_cache top;
+    struct region_cache middle;
+    struct region_cache bottom;
+    struct wpm_chart chart;
 };
 
 int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent);
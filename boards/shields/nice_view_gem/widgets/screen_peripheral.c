@@ -4,6 +4,7 @@
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include <zmk/event_manager.h>
+#include <zmk/events/activity_state_changed.h>
 #include <zmk/events/battery_state_changed.h>
 #include <zmk/events/usb_conn_state_changed.h>
 #include <zmk/split/bluetooth/peripheral.h>
@@ -15,25 +16,120 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include "animation.h"
 #include "battery.h"
+#include "digits.h"
+#include "framebuffer.h"
+#include "orientation.h"
 #include "output.h"
+#include "render_stats.h"
 #include "screen_peripheral.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
+static struct frame_scheduler frames;
+
+/**
+ * Change detection
+ **/
+
+static bool top_changed(const struct status_state *drawn, const struct status_state *state) {
+    return drawn->battery != state->battery || drawn->charging != state->charging ||
+           drawn->connected != state->connected;
+}
 
 /**
  * Draw buffers
  **/
 
-static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
-    fill_background(canvas);
+static void draw_top(struct zmk_widget_screen *widget) {
+    canvas_t *canvas = widget->scratch;
+    const struct status_state *state = &widget->state;
+
+    if (!region_should_render(&widget->top, state, top_changed)) {
+        return;
+    }
+
+    RENDER_STATS_START(start);
+    resize_scratch(canvas, REGION_TOP_HEIGHT);
+    load_background(canvas, widget->bgbuf);
 
     // Draw widgets
     draw_output_status(canvas, state);
     draw_battery_status(canvas, state);
 
     // Rotate for horizontal display
-    rotate_canvas(canvas, cbuf);
+    uint16_t rows = rotate_canvas(canvas, widget->top_region, widget->cbuf);
+    RENDER_STATS_RECORD(RENDER_STAT_TOP, start);
+    LOG_DBG("Render top: %u lines changed (%u rendered, %u skipped)", rows,
+            widget->top.rendered, widget->top.skipped);
+}
+
+// The region buffer still holds the old orientation after moving, so the region renders in full
+static void change_orientation(struct zmk_widget_screen *widget) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    framebuffer_clear();
+#endif
+    place_region(widget->top_region, widget->cbuf, REGION_TOP_OFFSET, REGION_TOP_ALIGN_Y);
+
+    widget->top.valid = false;
+    widget->dirty |= REGION_TOP;
+}
+
+static void init_backgrounds(struct zmk_widget_screen *widget) {
+    canvas_t *canvas = widget->scratch;
+
+    resize_scratch(canvas, REGION_TOP_HEIGHT);
+    fill_background(canvas);
+    draw_output_background(canvas);
+    draw_battery_background(canvas);
+    save_background(canvas, widget->bgbuf);
+}
+
+/**
+ * Frame scheduling
+ **/
+
+static void render_frame(struct k_work *work) {
+    struct zmk_widget_screen *widget;
+    bool rotated = orientation_update();
+
+    frame_scheduler_begin(&frames);
+
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) {
+        if (rotated) {
+            change_orientation(widget);
+        }
+
+        uint8_t dirty = widget->dirty;
+        widget->dirty = 0;
+
+        if (dirty & REGION_TOP) {
+            draw_top(widget);
+        }
+    }
+
+    if (rotated) {
+        place_animation();
+    }
+
+    frame_scheduler_end(&frames);
+    RENDER_STATS_FRAME();
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    framebuffer_flush();
+#endif
+}
+
+static void mark_dirty(struct zmk_widget_screen *widget, uint8_t regions) {
+    RENDER_STATS_WAKEUP();
+    // Held updates are timed from their release instead
+    if (!frames.holding) {
+        RENDER_STATS_EVENT();
+    }
+    widget->dirty |= regions;
+    frame_scheduler_request(&frames);
+}
+
+static void orientation_changed(void) {
+    struct zmk_widget_screen *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { mark_dirty(widget, REGION_TOP); }
 }
 
 /**
@@ -48,7 +144,7 @@ static void set_battery_status(struct zmk_widget_screen *widget,
 
     widget->state.battery = state.level;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    mark_dirty(widget, REGION_TOP);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -87,7 +183,7 @@ static void set_connection_status(struct zmk_widget_screen *widget,
                                   struct peripheral_status_state state) {
     widget->state.connected = state.connected;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    mark_dirty(widget, REGION_TOP);
 }
 
 static void output_status_update_cb(struct peripheral_status_state state) {
@@ -99,23 +195,63 @@ ZMK_DISPLAY_WIDGET_LISTENER(widget_peripheral_status, struct peripheral_status_s
                             output_status_update_cb, get_state)
 ZMK_SUBSCRIPTION(widget_peripheral_status, zmk_split_peripheral_status_changed);
 
+/**
+ * Activity status
+ **/
+
+// Leaves the panel with its last image and does no render work until activity resumes. The
+// memory LCD keeps its image without refreshes, and the region buffer and last rendered state
+// stay in RAM, so waking re-renders only if the state changed while idle.
+static void activity_status_update_cb(struct activity_status_state state) {
+    if (state.state == ZMK_ACTIVITY_ACTIVE) {
+        RENDER_STATS_IDLE(false);
+        if (frame_scheduler_release(&frames)) {
+            RENDER_STATS_EVENT();
+        }
+    } else {
+        frame_scheduler_freeze(&frames);
+        RENDER_STATS_IDLE(true);
+    }
+}
+
+static struct activity_status_state activity_status_get_state(const zmk_event_t *eh) {
+    return (struct activity_status_state){.state = zmk_activity_get_state()};
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_activity_status, struct activity_status_state,
+                            activity_status_update_cb, activity_status_get_state)
+ZMK_SUBSCRIPTION(widget_activity_status, zmk_activity_state_changed);
+
 /**
  * Initialization
  **/
 
 int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_DIRECT_FRAMEBUFFER)
+    widget->obj = NULL;
+    framebuffer_init();
+#else
     widget->obj = lv_obj_create(parent);
     lv_obj_set_size(widget->obj, SCREEN_HEIGHT, SCREEN_WIDTH);
+#endif
 
-    lv_obj_t *top = lv_canvas_create(widget->obj);
-    lv_obj_align(top, LV_ALIGN_BOTTOM_LEFT, 0, -2);
-    lv_canvas_set_buffer(top, widget->cbuf, BUFFER_SIZE, BUFFER_SIZE, LV_IMG_CF_TRUE_COLOR);
+    orientation_init(orientation_changed);
+    widget->top_region = create_region(widget->obj, widget->cbuf, REGION_TOP_HEIGHT);
+    place_region(widget->top_region, widget->cbuf, REGION_TOP_OFFSET, REGION_TOP_ALIGN_Y);
 
     draw_animation(widget->obj);
 
+    widget->scratch = create_scratch_canvas(widget->obj);
+    init_digit_sprites();
+    init_backgrounds(widget);
+
+    frame_scheduler_init(&frames, render_frame);
+    RENDER_STATS_INIT();
     sys_slist_append(&widgets, &widget->node);
     widget_battery_status_init();
     widget_peripheral_status_init();
+    frame_scheduler_release(&frames);
+    widget_activity_status_init();
 
     return 0;
 }
@@ -7,8 +7,13 @@
 struct zmk_widget_screen {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[BUFFER_SIZE * BUFFER_SIZE];
+    canvas_t *scratch;
+    region_t *top_region;
+    uint8_t cbuf[CANVAS_BUF_SIZE(REGION_TOP_HEIGHT)];
+    uint8_t bgbuf[BACKGROUND_BUF_SIZE(REGION_TOP_HEIGHT)];
     struct status_state state;
+    uint8_t dirty;
+    struct region_cache top;
 };
 
 int zmk_widget_screen_init(struct zmk_widget_screen *widget, lv_obj_t *parent);
@@ -1,6 +1,12 @@
 #include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
 #include "util.h"
 #include <ctype.h>
+#include <zmk/display.h>
+#include "render_stats.h"
 
 void to_uppercase(char *str) {
     for (int i = 0; str[i] != '\0'; i++) {
@@ -8,45 +14,123 @@ void to_uppercase(char *str) {
     }
 }
 
-void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]) {
-    static lv_color_t cbuf_tmp[BUFFER_SIZE * BUFFER_SIZE];
-    memcpy(cbuf_tmp, cbuf, sizeof(cbuf_tmp));
-    lv_img_dsc_t img;
-    img.data = (void *)cbuf_tmp;
-    img.header.cf = LV_IMG_CF_TRUE_COLOR;
-    img.header.w = BUFFER_SIZE;
-    img.header.h = BUFFER_SIZE;
-    lv_canvas_fill_bg(canvas, LVGL_BACKGROUND, LV_OPA_COVER);
-    // 修改旋转角度为 270 度 (270 * 10 = 2700)
-    // 原角度为 90 度 (90 * 10 = 900)
-    lv_canvas_transform(canvas, &img, 2700, LV_IMG_ZOOM_NONE, -1, 0, BUFFER_SIZE / 2,
-                        BUFFER_SIZE / 2, false);
+void frame_scheduler_init(struct frame_scheduler *frames, k_work_handler_t render) {
+    k_work_init_delayable(&frames->work, render);
+    frames->last_frame = -CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS;
+    frames->holding = true;
 }
 
-void fill_background(lv_obj_t *canvas) {
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_canvas_draw_rect(canvas, 0, 0, BUFFER_SIZE, BUFFER_SIZE, &rect_black_dsc);
+void frame_scheduler_request(struct frame_scheduler *frames) {
+    if (frames->holding) {
+        frames->pending = true;
+        return;
+    }
+
+    int64_t elapsed = k_uptime_get() - frames->last_frame;
+    k_timeout_t delay = K_NO_WAIT;
+
+    if (elapsed < CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS) {
+        delay = K_MSEC(CONFIG_NICE_VIEW_GEM_FRAME_INTERVAL_MS - elapsed);
+    }
+
+    // No-op while a frame is already pending, so every request until it runs joins that frame.
+    // Listener work items queued ahead of it are also drained before it renders.
+    k_work_schedule_for_queue(zmk_display_work_q(), &frames->work, delay);
 }
 
-void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
-                    lv_text_align_t align) {
-    lv_draw_label_dsc_init(label_dsc);
-    label_dsc->color = color;
-    label_dsc->font = font;
-    label_dsc->align = align;
+// Lets a frame that is already scheduled render as the last one, then holds every request
+void frame_scheduler_freeze(struct frame_scheduler *frames) {
+    if (k_work_delayable_is_pending(&frames->work)) {
+        frames->freezing = true;
+    } else {
+        frames->holding = true;
+    }
 }
 
-void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color) {
-    lv_draw_rect_dsc_init(rect_dsc);
-    rect_dsc->bg_color = bg_color;
+// Renders everything requested during the hold as a single frame, so each region is rendered at
+// most once. Returns whether a frame was requested.
+bool frame_scheduler_release(struct frame_scheduler *frames) {
+    bool pending = frames->pending;
+
+    frames->holding = false;
+    frames->freezing = false;
+    frames->pending = false;
+
+    if (pending) {
+        frame_scheduler_request(frames);
+    }
+
+    return pending;
 }
 
-void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color, uint8_t width) {
-    lv_draw_line_dsc_init(line_dsc);
-    line_dsc->color = color;
-    line_dsc->width = width;
+void frame_scheduler_begin(struct frame_scheduler *frames) { frames->last_frame = k_uptime_get(); }
+
+void frame_scheduler_end(struct frame_scheduler *frames) {
+    if (frames->freezing) {
+        frames->freezing = false;
+        frames->holding = true;
+    }
+
+    if (!frames->shown) {
+        frames->shown = true;
+        LOG_INF("First status frame rendered %lld ms after boot", k_uptime_get());
+    }
 }
 
+bool region_should_render(struct region_cache *cache, const struct status_state *state,
+                          region_changed_t changed) {
+    if (cache->valid && !changed(&cache->state, state)) {
+        cache->skipped++;
+        return false;
+    }
+
+    cache->state = *state;
+    cache->valid = true;
+    cache->rendered++;
+    return true;
+}
+
+// Overwrites columns [x, x + w) of every region buffer row with src, which holds the bytes
+// covering those columns for each row in turn, then presents the rows that changed
+uint16_t blit_columns(region_t *region, uint8_t cbuf[], const uint8_t *src, uint16_t x,
+                      uint16_t w) {
+    uint16_t stride = PACKED_STRIDE(region_width(region));
+    uint16_t first = x / 8;
+    uint16_t bytes = PACKED_STRIDE(x + w) - first;
+    uint8_t masks[PACKED_STRIDE(SCRATCH_HEIGHT)];
+    uint8_t damage[SCREEN_WIDTH] = {0};
+    uint8_t *dst = cbuf + CANVAS_PALETTE_SIZE + first;
+    uint16_t changed;
+
+    for (uint16_t i = 0; i < bytes; i++) {
+        uint16_t lo = MAX(x, (first + i) * 8) - (first + i) * 8;
+        uint16_t hi = MIN(x + w, (first + i + 1) * 8) - (first + i) * 8;
+        masks[i] = (0xFF >> lo) & (0xFF << (8 - hi));
+    }
+
+    for (uint16_t y = 0; y < SCREEN_WIDTH; y++, dst += stride) {
+        for (uint16_t i = 0; i < bytes; i++) {
+            uint8_t byte = (dst[i] & ~masks[i]) | (*src++ & masks[i]);
+            damage[y] |= dst[i] ^ byte;
+            dst[i] = byte;
+        }
+    }
 
+    changed = present_rows(region, cbuf, damage);
+    RENDER_STATS_DAMAGE(changed);
 
+    return changed;
+}
+
+void fill_background(canvas_t *canvas) {
+    canvas_fill_rect(canvas, 0, 0, SCREEN_WIDTH, canvas_height(canvas), LVGL_BACKGROUND);
+}
+
+// Static layers are kept packed in scratch orientation and expanded at the start of each render
+void save_background(canvas_t *scratch, uint8_t bgbuf[]) {
+    canvas_pack_rows(scratch, 0, canvas_height(scratch), bgbuf);
+}
+
+void load_background(canvas_t *scratch, const uint8_t bgbuf[]) {
+    canvas_unpack_rows(scratch, 0, canvas_height(scratch), bgbuf);
+}
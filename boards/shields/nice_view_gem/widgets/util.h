@@ -1,20 +1,41 @@
 #pragma once
 
 #include <lvgl.h>
+#include <zephyr/kernel.h>
+#include <zmk/activity.h>
 #include <zmk/endpoints.h>
+#include "canvas.h"
+#include "layout.h"
+#include "rotate.h"
 
-#define SCREEN_WIDTH 68
-#define SCREEN_HEIGHT 160
-
-#define BUFFER_SIZE 68
-#define BUFFER_OFFSET_MIDDLE -44
-#define BUFFER_OFFSET_BOTTOM -129
+#define BACKGROUND_BUF_SIZE(height) PACKED_SIZE(SCREEN_WIDTH, height)
 
 #define LVGL_BACKGROUND                                                                            \
     IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_black() : lv_color_white()
 #define LVGL_FOREGROUND                                                                            \
     IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_white() : lv_color_black()
 
+#define WPM_HISTORY CONFIG_NICE_VIEW_GEM_WPM_HISTORY
+
+// Ring buffer slots ordered by age, with values monotonic from head to back
+struct wpm_queue {
+    uint8_t slots[WPM_HISTORY];
+    uint8_t head;
+    uint8_t len;
+};
+
+// Last WPM_HISTORY samples. The queues keep the running minimum and maximum at their heads, so
+// a new sample costs O(1) amortized whatever the history length. The version changes whenever
+// the window of samples does, while pushed counts every sample.
+struct wpm_history {
+    uint8_t samples[WPM_HISTORY];
+    uint8_t next;
+    struct wpm_queue min;
+    struct wpm_queue max;
+    uint32_t version;
+    uint32_t pushed;
+};
+
 struct status_state {
     uint8_t battery;
     bool charging;
@@ -25,16 +46,57 @@ struct status_state {
     bool active_profile_bonded;
     uint8_t layer_index;
     const char *layer_label;
-    uint8_t wpm[10];
+    struct wpm_history wpm;
+    // Set while idle: the gauge and value read 0 until the next sample, which the chart is not
+    // given
+    bool wpm_idle;
 #else
     bool connected;
 #endif
 };
 
+struct activity_status_state {
+    enum zmk_activity_state state;
+};
+
+// Last state a region was rendered with, so unchanged events can skip the render entirely
+struct region_cache {
+    struct status_state state;
+    bool valid;
+    uint32_t rendered;
+    uint32_t skipped;
+};
+
+#define REGION_TOP BIT(0)
+#define REGION_MIDDLE BIT(1)
+#define REGION_BOTTOM BIT(2)
+
+// Coalesces region updates into frames rendered on the display work queue. Requests made while
+// the screen initializes or is frozen for idle are held back and rendered together as one frame
+// when released.
+struct frame_scheduler {
+    struct k_work_delayable work;
+    int64_t last_frame;
+    bool holding;
+    bool freezing;
+    bool pending;
+    bool shown;
+};
+
+typedef bool (*region_changed_t)(const struct status_state *drawn,
+                                 const struct status_state *state);
+
 void to_uppercase(char *str);
-void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]);
-void fill_background(lv_obj_t *canvas);
-void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color);
-void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color, uint8_t width);
-void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
-                    lv_text_align_t align);
\ No newline at end of file
+void frame_scheduler_init(struct frame_scheduler *frames, k_work_handler_t render);
+void frame_scheduler_request(struct frame_scheduler *frames);
+void frame_scheduler_freeze(struct frame_scheduler *frames);
+bool frame_scheduler_release(struct frame_scheduler *frames);
+void frame_scheduler_begin(struct frame_scheduler *frames);
+void frame_scheduler_end(struct frame_scheduler *frames);
+bool region_should_render(struct region_cache *cache, const struct status_state *state,
+                          region_changed_t changed);
+uint16_t blit_columns(region_t *region, uint8_t cbuf[], const uint8_t *src, uint16_t x,
+                      uint16_t w);
+void fill_background(canvas_t *canvas);
+void save_background(canvas_t *scratch, uint8_t bgbuf[]);
+void load_background(canvas_t *scratch, const uint8_t bgbuf[]);
\ No newline at end of file
@@ -1,139 +1,296 @@
-#include <math.h>
 #include <zephyr/kernel.h>
+#include "digits.h"
+#include "rle.h"
 #include "wpm.h"
-#include "../assets/custom_fonts.h"
-LV_IMG_DECLARE(gauge);
-LV_IMG_DECLARE(grid);
+RLE_IMAGE_DECLARE(gauge);
+RLE_IMAGE_DECLARE(grid);
 
-// 居中偏移量常量
-#define WPM_CENTERING_OFFSET_X 1
+BUILD_ASSERT(WPM_HISTORY <= RECT_W(LAYOUT_WPM_GRAPH), "More WPM samples than graph pixels");
+BUILD_ASSERT(RECT_W(LAYOUT_WPM_VALUE) >= 3 * DIGIT_CELL_WIDTH, "255 WPM does not fit");
 
-static void draw_gauge(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
+/**
+ * History
+ **/
+
+static void queue_evict(struct wpm_queue *queue, uint8_t slot) {
+    if (queue->len > 0 && queue->slots[queue->head] == slot) {
+        queue->head = (queue->head + 1) % WPM_HISTORY;
+        queue->len--;
+    }
+}
+
+// Drops queued samples the new one supersedes: for order 1 those not below it (minimum queue),
+// for order -1 those not above it (maximum queue)
+static void queue_push(struct wpm_queue *queue, const uint8_t samples[], uint8_t slot, int order) {
+    while (queue->len > 0) {
+        uint8_t back = queue->slots[(queue->head + queue->len - 1) % WPM_HISTORY];
+        if ((samples[back] - samples[slot]) * order < 0) {
+            break;
+        }
+        queue->len--;
+    }
+
+    queue->slots[(queue->head + queue->len) % WPM_HISTORY] = slot;
+    queue->len++;
+}
+
+void wpm_history_init(struct wpm_history *history) {
+    memset(history, 0, sizeof(*history));
+
+    // Every sample starts at 0, so the newest one is both minimum and maximum
+    history->min.slots[0] = WPM_HISTORY - 1;
+    history->min.len = 1;
+    history->max.slots[0] = WPM_HISTORY - 1;
+    history->max.len = 1;
+}
+
+void wpm_history_push(struct wpm_history *history, uint8_t value) {
+    uint8_t slot = history->next;
+
+    // Shifting a window of identical samples in by one more leaves it unchanged
+    if (wpm_history_min(history) != value || wpm_history_max(history) != value) {
+        history->version++;
+    }
+
+    queue_evict(&history->min, slot);
+    queue_evict(&history->max, slot);
+
+    history->samples[slot] = value;
+    history->next = (slot + 1) % WPM_HISTORY;
+    history->pushed++;
+
+    queue_push(&history->min, history->samples, slot, 1);
+    queue_push(&history->max, history->samples, slot, -1);
+}
+
+/**
+ * Drawing
+ **/
+
+static void draw_gauge(canvas_t *canvas) {
     // Gauge 位置
-    lv_canvas_draw_img(canvas, 16, 44 + BUFFER_OFFSET_MIDDLE, &gauge, &img_dsc);
+    canvas_draw_rle(canvas, RECT_X(LAYOUT_WPM_GAUGE), RECT_Y(LAYOUT_WPM_GAUGE), &gauge);
 }
 
-static void draw_needle(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_line_dsc_t line_dsc;
-    init_line_dsc(&line_dsc, LVGL_FOREGROUND, 1);
-    // Needle 参数
-    int centerX = 33;
-    int centerY = 67 + BUFFER_OFFSET_MIDDLE;
-    int offset = 13;
-    int value = state->wpm[9];
-#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE)
-    float max = CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX;
-#else
-    float max = 0;
-    for (int i = 0; i < 10; i++) {
-        if (state->wpm[i] > max) {
-            max = state->wpm[i];
+/**
+ * Needle
+ **/
+
+// The truncated needle end points only change at a few dozen angles across the sweep, so the
+// needle is drawn from a table of those positions, keyed by sweep fraction in
+// 1/2^NEEDLE_FRACTION_BITS. scripts/needle_table.py generates it from the radii in layout.h.
+struct needle_position {
+    uint32_t from;
+    int8_t start_x;
+    int8_t start_y;
+    int8_t end_x;
+    int8_t end_y;
+};
+
+#include "wpm_needle.h"
+
+// The current geometry has 77 positions
+#define NEEDLE_POSITIONS 80
+
+BUILD_ASSERT(ARRAY_SIZE(needle_positions) <= NEEDLE_POSITIONS, "Too many needle positions");
+
+// Last position starting at or before the fraction of the sweep value is of max
+static const struct needle_position *needle_for(int value, int max) {
+    // WPM samples are 8 bit, so the shifted value fits 32 bits
+    uint32_t fraction = ((uint32_t)MIN(value, max) << NEEDLE_FRACTION_BITS) / max;
+    int lo = 0;
+    int hi = ARRAY_SIZE(needle_positions) - 1;
+
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (needle_positions[mid].from <= fraction) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
         }
     }
-#endif
-    if (max == 0)
-        max = 100;
-    if (value < 0)
-        value = 0;
-    if (value > max)
-        value = max;
-    float radius = 25.45585;
-    float angleDeg = 225 + ((float)value / max) * 90;
-    float angleRad = angleDeg * (3.14159f / 180.0f);
-    int needleStartX = centerX + (int)((float)offset * cosf(angleRad));
-    int needleStartY = centerY + (int)((float)offset * sinf(angleRad));
-    int needleEndX = centerX + (int)(radius * cosf(angleRad));
-    int needleEndY = centerY + (int)(radius * sinf(angleRad));
-    lv_point_t points[2] = {{needleStartX, needleStartY}, {needleEndX, needleEndY}};
-    lv_canvas_draw_line(canvas, points, 2, &line_dsc);
-}
-
-static void draw_grid(lv_obj_t *canvas) {
-    lv_draw_img_dsc_t img_dsc;
-    lv_draw_img_dsc_init(&img_dsc);
-    // 应用居中偏移量到 grid 的 x 坐标
-    // 原代码: lv_canvas_draw_img(canvas, 0, 65 + BUFFER_OFFSET_MIDDLE, &grid, &img_dsc);
-    lv_canvas_draw_img(canvas, WPM_CENTERING_OFFSET_X, 65 + BUFFER_OFFSET_MIDDLE, &grid, &img_dsc);
-    // 注意：如果 grid 图像本身是 68 像素宽，
-    // LVGL 可能会自动裁剪掉超出画布 (68x68) 右边界的 4 个像素 (如果画布最终显示区域被限制)。
-    // 如果没有自动裁剪，且 grid 图像宽度确实是 68，则保留原样。
-}
-
-static void draw_graph(lv_obj_t *canvas, const struct status_state *state) {
-    lv_draw_line_dsc_t line_dsc;
-    init_line_dsc(&line_dsc, LVGL_FOREGROUND, 2);
-    lv_point_t points[10];
-    // Y 坐标计算
-    int baselineY = 97 + BUFFER_OFFSET_MIDDLE;
-
-    // --- X 坐标计算逻辑 ---
+
+    return &needle_positions[lo];
+}
+
+static void draw_needle(canvas_t *canvas, const struct status_state *state) {
+    int value = wpm_shown(state);
 #if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE)
     int max = CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX;
+#else
+    int max = wpm_history_max(&state->wpm);
+#endif
     if (max == 0) {
         max = 100;
     }
-    int value = 0;
-    for (int i = 0; i < 10; i++) {
-        value = state->wpm[i];
-        if (value > max) {
-            value = max;
-        }
-        // 应用居中偏移量
-        // 原代码: points[i].x = 0 + i * 7.4;
-        points[i].x = WPM_CENTERING_OFFSET_X + (int)(i * 7.4);
-        points[i].y = baselineY - (value * 32 / max);
+
+    const struct needle_position *needle = needle_for(value, max);
+    lv_point_t points[2] = {
+        {WPM_NEEDLE_X + needle->start_x, WPM_NEEDLE_Y + needle->start_y},
+        {WPM_NEEDLE_X + needle->end_x, WPM_NEEDLE_Y + needle->end_y},
+    };
+    canvas_draw_line(canvas, points, 2, LVGL_FOREGROUND, 1);
+}
+
+static void draw_grid(canvas_t *canvas) {
+    canvas_draw_rle(canvas, RECT_X(LAYOUT_WPM_GRAPH), RECT_Y(LAYOUT_WPM_GRAPH), &grid);
+}
+
+/**
+ * Chart
+ *
+ * The chart line is kept as a 1bpp mask of the graph rows between renders. A new sample scrolls
+ * the mask left by one step and only the newest segment is drawn; the whole line is redrawn when
+ * the range rescales or more samples arrived than the chart holds.
+ **/
+
+// Samples are one step apart, anchored at the right edge of the graph. Scrolling needs a whole
+// pixel step, so the default 10 samples sit at x = 4, 11, ..., 67 instead of the 1, 8, 15, 23, ...
+// of the 7.4 px spacing the chart was drawn with before: the line starts 3 px further right.
+#define GRAPH_STEP ((RECT_W(LAYOUT_WPM_GRAPH) - 1) / (WPM_HISTORY - 1))
+#define GRAPH_X(i)                                                                                 \
+    (RECT_X(LAYOUT_WPM_GRAPH) + RECT_W(LAYOUT_WPM_GRAPH) - 1 - (WPM_HISTORY - 1 - (i)) * GRAPH_STEP)
+
+#define CHART_STRIDE PACKED_STRIDE(SCREEN_WIDTH)
+
+BUILD_ASSERT(WPM_CHART_Y >= 0 && WPM_CHART_Y + WPM_CHART_HEIGHT <= REGION_MIDDLE_HEIGHT,
+             "Chart off region");
+
+static void graph_range(const struct wpm_history *history, int *min, int *max) {
+#if IS_ENABLED(CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE)
+    *min = 0;
+    *max = CONFIG_NICE_VIEW_GEM_WPM_FIXED_RANGE_MAX;
+    if (*max == 0) {
+        *max = 100;
     }
 #else
-    int max = 0;
-    int min = 256;
-    for (int i = 0; i < 10; i++) {
-        if (state->wpm[i] > max) {
-            max = state->wpm[i];
+    *min = wpm_history_min(history);
+    *max = wpm_history_max(history);
+#endif
+}
+
+static lv_point_t graph_point(const struct wpm_history *history, int i, int min, int max) {
+    int baselineY = RECT_Y(LAYOUT_WPM_GRAPH) + RECT_H(LAYOUT_WPM_GRAPH) - 1;
+    int height = RECT_H(LAYOUT_WPM_GRAPH) - 1;
+    int range = MAX(max - min, 1);
+    int value = MIN(wpm_history_at(history, i), max) - min;
+
+    return (lv_point_t){.x = GRAPH_X(i), .y = baselineY - value * height / range};
+}
+
+// Draws the line between samples first and last in white on the black chart rows
+static void draw_segments(canvas_t *canvas, const struct wpm_history *history, int min, int max,
+                          int first, int last) {
+    lv_point_t points[WPM_HISTORY];
+
+    for (int i = first; i <= last; i++) {
+        points[i - first] = graph_point(history, i, min, max);
+    }
+    canvas_draw_line(canvas, points, last - first + 1, lv_color_white(), 2);
+}
+
+static void scroll_chart(struct wpm_chart *chart, uint16_t shift) {
+    uint16_t bytes = shift / 8;
+    uint8_t bits = shift % 8;
+
+    for (uint8_t *row = chart->mask; row < chart->mask + sizeof(chart->mask);
+         row += CHART_STRIDE) {
+        for (uint16_t i = 0; i < CHART_STRIDE; i++) {
+            uint8_t hi = (i + bytes < CHART_STRIDE) ? row[i + bytes] : 0;
+            uint8_t lo = (i + bytes + 1 < CHART_STRIDE) ? row[i + bytes + 1] : 0;
+            row[i] = bits ? (hi << bits) | (lo >> (8 - bits)) : hi;
         }
-        if (state->wpm[i] < min) {
-            min = state->wpm[i];
+    }
+}
+
+static void clear_chart_columns(struct wpm_chart *chart, uint16_t end) {
+    for (uint8_t *row = chart->mask; row < chart->mask + sizeof(chart->mask);
+         row += CHART_STRIDE) {
+        memset(row, 0, end / 8);
+        if (end % 8) {
+            row[end / 8] &= 0xFF >> (end % 8);
         }
     }
-    int range = max - min;
-    if (range == 0) {
-        range = 1;
+}
+
+void update_wpm_chart(canvas_t *canvas, struct wpm_chart *chart,
+                      const struct status_state *state) {
+    const struct wpm_history *history = &state->wpm;
+    uint32_t samples = history->pushed - chart->pushed;
+    uint8_t segments[PACKED_SIZE(SCREEN_WIDTH, WPM_CHART_HEIGHT)];
+    int min, max;
+
+    graph_range(history, &min, &max);
+    bool rescaled = !chart->valid || min != chart->min || max != chart->max;
+    if (!rescaled && samples == 0) {
+        return;
     }
-    for (int i = 0; i < 10; i++) {
-        // 应用居中偏移量
-        // 原代码: points[i].x = 0 + i * 7.4;
-        points[i].x = WPM_CENTERING_OFFSET_X + (int)(i * 7.4);
-        points[i].y = baselineY - (state->wpm[i] - min) * 32 / range;
+
+    canvas_fill_rect(canvas, 0, WPM_CHART_Y, SCREEN_WIDTH, WPM_CHART_HEIGHT, lv_color_black());
+
+    if (rescaled || samples >= WPM_HISTORY - 1) {
+        draw_segments(canvas, history, min, max, 0, WPM_HISTORY - 1);
+        memset(chart->mask, 0, sizeof(chart->mask));
+    } else {
+        // Segments that scrolled off leave pixels up to the first sample; clear those columns
+        // and redraw every remaining segment that reaches into them
+        uint16_t cleared = GRAPH_X(0) + WPM_CHART_REACH + 1;
+        int last = 0;
+        while (last < WPM_HISTORY - 1 && GRAPH_X(last) - WPM_CHART_REACH < cleared) {
+            last++;
+        }
+
+        // Besides the new segments, redraw those that were clipped at the right edge before
+        // scrolling into view
+        int first = WPM_HISTORY - 1 - samples;
+        while (first > 0 && GRAPH_X(first + samples) + WPM_CHART_REACH >= SCREEN_WIDTH) {
+            first--;
+        }
+
+        scroll_chart(chart, samples * GRAPH_STEP);
+        clear_chart_columns(chart, cleared);
+        draw_segments(canvas, history, min, max, 0, last);
+        draw_segments(canvas, history, min, max, first, WPM_HISTORY - 1);
     }
-#endif
-    // --- 绘制线条 ---
-    lv_canvas_draw_line(canvas, points, 10, &line_dsc);
+
+    canvas_pack_rows(canvas, WPM_CHART_Y, WPM_CHART_HEIGHT, segments);
+    for (size_t i = 0; i < sizeof(chart->mask); i++) {
+        chart->mask[i] |= segments[i];
+    }
+
+    chart->valid = true;
+    chart->pushed = history->pushed;
+    chart->min = min;
+    chart->max = max;
 }
 
-static void draw_label(lv_obj_t *canvas, const struct status_state *state) {
+static void draw_chart(canvas_t *canvas, const struct wpm_chart *chart) {
+    canvas_draw_bits(canvas, 0, WPM_CHART_Y, SCREEN_WIDTH, WPM_CHART_HEIGHT, chart->mask,
+                     CHART_STRIDE, LVGL_FOREGROUND);
+}
+
+static void draw_label(canvas_t *canvas) {
     // 绘制 "WPM" 文本 - 向右移动 4 像素
-    lv_draw_label_dsc_t label_left_dsc;
-    init_label_dsc(&label_left_dsc, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_LEFT);
-    // 原始 x=0, 修改为 x=4
-    lv_canvas_draw_text(canvas, 3, 101 + BUFFER_OFFSET_MIDDLE, 25, &label_left_dsc, "WPM");
-
-    // 绘制 WPM 计数值文本 - 向右移动 2 像素 (文本框整体右移)
-    lv_draw_label_dsc_t label_dsc_wpm;
-    init_label_dsc(&label_dsc_wpm, LVGL_FOREGROUND, &pixel_operator_mono, LV_TEXT_ALIGN_RIGHT);
-    char wpm_text[6] = {};
-    snprintf(wpm_text, sizeof(wpm_text), "%d", state->wpm[9]);
-    // 原始 x=26, 修改为 x=28
-    // width 和对齐方式保持不变
-    lv_canvas_draw_text(canvas, 24, 101 + BUFFER_OFFSET_MIDDLE, 42, &label_dsc_wpm, wpm_text);
-}
-
-void draw_wpm_status(lv_obj_t *canvas, const struct status_state *state) {
-    draw_gauge(canvas, state);
-    draw_needle(canvas, state);
+    canvas_draw_text(canvas, RECT_X(LAYOUT_WPM_LABEL), RECT_Y(LAYOUT_WPM_LABEL),
+                     RECT_W(LAYOUT_WPM_LABEL), LV_TEXT_ALIGN_LEFT, "WPM");
+}
+
+static void draw_value(canvas_t *canvas, const struct status_state *state) {
+    draw_number(canvas, RECT_X(LAYOUT_WPM_VALUE), RECT_Y(LAYOUT_WPM_VALUE),
+                RECT_W(LAYOUT_WPM_VALUE), wpm_shown(state), false);
+}
+
+void draw_wpm_background(canvas_t *canvas) {
+    draw_gauge(canvas);
     draw_grid(canvas);
-    draw_graph(canvas, state);
-    draw_label(canvas, state);
+    draw_label(canvas);
+}
+
+void draw_wpm_status(canvas_t *canvas, const struct wpm_chart *chart,
+                     const struct status_state *state) {
+    draw_needle(canvas, state);
+    draw_chart(canvas, chart);
+    draw_value(canvas, state);
 }
 
 
@@ -7,4 +7,49 @@ struct wpm_status_state {
     uint8_t wpm;
 };
 
-void draw_wpm_status(lv_obj_t *canvas, const struct status_state *state);
\ No newline at end of file
+// How far the 2 px chart line may reach past its end points, with a pixel to spare
+#define WPM_CHART_REACH 2
+#define WPM_CHART_Y (RECT_Y(LAYOUT_WPM_GRAPH) - WPM_CHART_REACH)
+#define WPM_CHART_HEIGHT (RECT_H(LAYOUT_WPM_GRAPH) + 2 * WPM_CHART_REACH)
+
+// The chart line as drawn so far, kept between renders of the middle region
+struct wpm_chart {
+    // 1bpp mask of the graph rows, set where the line is
+    uint8_t mask[PACKED_SIZE(SCREEN_WIDTH, WPM_CHART_HEIGHT)];
+    bool valid;
+    uint32_t pushed;
+    int min;
+    int max;
+};
+
+void wpm_history_init(struct wpm_history *history);
+void wpm_history_push(struct wpm_history *history, uint8_t value);
+
+// Sample i of the history, oldest first
+static inline uint8_t wpm_history_at(const struct wpm_history *history, uint8_t i) {
+    return history->samples[(history->next + i) % WPM_HISTORY];
+}
+
+static inline uint8_t wpm_history_latest(const struct wpm_history *history) {
+    return wpm_history_at(history, WPM_HISTORY - 1);
+}
+
+// WPM the gauge and value show
+static inline uint8_t wpm_shown(const struct status_state *state) {
+    return state->wpm_idle ? 0 : wpm_history_latest(&state->wpm);
+}
+
+static inline uint8_t wpm_history_min(const struct wpm_history *history) {
+    return history->samples[history->min.slots[history->min.head]];
+}
+
+static inline uint8_t wpm_history_max(const struct wpm_history *history) {
+    return history->samples[history->max.slots[history->max.head]];
+}
+
+void draw_wpm_background(canvas_t *canvas);
+// Uses the canvas as a drawing surface, so it must run before the region background is loaded
+void update_wpm_chart(canvas_t *canvas, struct wpm_chart *chart,
+                      const struct status_state *state);
+void draw_wpm_status(canvas_t *canvas, const struct wpm_chart *chart,
+                     const struct status_state *state);
\ No newline at end of file